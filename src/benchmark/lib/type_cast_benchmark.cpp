@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include <boost/hana/for_each.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <string>
+#include <type_traits>
+
+#include "all_type_variant.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The boost::lexical_cast based implementation that type_cast used before, kept as a baseline
+template <typename T>
+T legacy_type_cast(const AllTypeVariant& value) {
+  if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+
+  if constexpr (std::is_integral_v<T>) {
+    try {
+      return boost::lexical_cast<T>(value);
+    } catch (...) {
+      return boost::numeric_cast<T>(boost::lexical_cast<double>(value));
+    }
+  } else {
+    return boost::lexical_cast<T>(value);
+  }
+}
+
+// A value of type T that can be converted into all other data types
+template <typename T>
+T convertible_value() {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return "4217";
+  } else {
+    return static_cast<T>(4217);
+  }
+}
+
+template <typename Source, typename Target, typename Cast>
+void run_type_cast_benchmark(benchmark::State& state, const Cast& cast) {
+  const auto value = AllTypeVariant{convertible_value<Source>()};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cast(value));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Registers BM_TypeCast/<source>/<target> and BM_LegacyTypeCast/<source>/<target> for all pairs of data types
+const auto registered_type_cast_benchmarks = [] {
+  hana::for_each(data_types, [](auto source) {
+    hana::for_each(data_types, [&](auto target) {
+      using Source = typename decltype(+hana::second(source))::type;
+      using Target = typename decltype(+hana::second(target))::type;
+      const auto name = std::string{hana::first(source)} + "/" + std::string{hana::first(target)};
+
+      benchmark::RegisterBenchmark(("BM_TypeCast/" + name).c_str(), [](benchmark::State& state) {
+        run_type_cast_benchmark<Source, Target>(state, [](const auto& value) { return type_cast<Target>(value); });
+      });
+      benchmark::RegisterBenchmark(("BM_LegacyTypeCast/" + name).c_str(), [](benchmark::State& state) {
+        run_type_cast_benchmark<Source, Target>(state,
+                                                [](const auto& value) { return legacy_type_cast<Target>(value); });
+      });
+    });
+  });
+  return true;
+}();
+
+}  // namespace
+
+}  // namespace opossum
@@ -0,0 +1,12 @@
+#include <benchmark/benchmark.h>
+
+#include "utils/performance_warning.hpp"
+
+int main(int argc, char** argv) {
+  // Benchmarks deliberately use slow paths like operator[] to compare them with the typed accessors
+  PerformanceWarningDisabler pwd;
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  ::benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/table.hpp"
+#include "utils/counting_memory_resource.hpp"
+
+namespace opossum {
+
+// Returns the value_index-th of distinct_values distinct values of type T. Values are spread over the value range so
+// that sorting has some work to do.
+template <typename T>
+T make_benchmark_value(const size_t row_index, const size_t distinct_values) {
+  const auto value_index = (row_index * 7919) % distinct_values;
+  if constexpr (std::is_same_v<T, std::string>) {
+    return "value_" + std::to_string(value_index);
+  } else {
+    return static_cast<T>(value_index);
+  }
+}
+
+// Creates a table with a single column of the given type that holds row_count rows with distinct_values values
+template <typename T>
+std::shared_ptr<Table> create_benchmark_table(const std::string& type, const size_t row_count,
+                                              const size_t distinct_values, const uint32_t chunk_size) {
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", type);
+  for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+    table->append({make_benchmark_value<T>(row_index, distinct_values)});
+  }
+  return table;
+}
+
+// Reports the allocations made through memory_resource, averaged over all iterations
+inline void report_allocations(benchmark::State& state, const CountingMemoryResource& memory_resource) {
+  state.counters["allocations"] = benchmark::Counter(static_cast<double>(memory_resource.allocation_count()),
+                                                     benchmark::Counter::kAvgIterations);
+  state.counters["allocated_bytes"] = benchmark::Counter(static_cast<double>(memory_resource.allocated_bytes()),
+                                                         benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace opossum
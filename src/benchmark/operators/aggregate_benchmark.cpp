@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "operators/aggregate.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/task_queue_scheduler.hpp"
+#include "storage/table.hpp"
+#include "utils/tpch_table_generator.hpp"
+
+namespace opossum {
+
+// The aggregation of TPC-H query 1 on a dictionary-compressed lineitem table at scale factor 0.1, argument is the
+// number of workers (0 runs the aggregate without a scheduler)
+static void BM_AggregateLineItem(benchmark::State& state) {
+  const auto line_item_table = TpchTableGenerator{0.1f}.generate_table(TpchTable::LineItem);
+  for (auto chunk_id = ChunkID{0}; chunk_id < line_item_table->chunk_count(); ++chunk_id) {
+    line_item_table->compress_chunk(chunk_id);
+  }
+  auto line_item = std::make_shared<TableWrapper>(line_item_table);
+  line_item->execute();
+
+  // l_returnflag, l_linestatus and l_quantity, l_extendedprice, l_discount
+  const auto group_by_column_ids = std::vector<ColumnID>{ColumnID{8}, ColumnID{9}};
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{4}, AggregateFunction::Sum},
+                                                                 {ColumnID{5}, AggregateFunction::Sum},
+                                                                 {ColumnID{6}, AggregateFunction::Avg},
+                                                                 {std::nullopt, AggregateFunction::Count}};
+
+  if (state.range(0) > 0) CurrentScheduler::set(std::make_shared<TaskQueueScheduler>(state.range(0)));
+
+  for (auto _ : state) {
+    auto aggregate = std::make_shared<Aggregate>(line_item, aggregates, group_by_column_ids);
+    aggregate->execute();
+    benchmark::DoNotOptimize(aggregate->get_output()->row_count());
+  }
+
+  CurrentScheduler::set(nullptr);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * line_item_table->row_count()));
+}
+BENCHMARK(BM_AggregateLineItem)->Arg(0)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+}  // namespace opossum
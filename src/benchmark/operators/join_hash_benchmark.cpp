@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <utility>
+
+#include "operators/join_hash.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/task_queue_scheduler.hpp"
+#include "storage/table.hpp"
+#include "utils/tpch_table_generator.hpp"
+
+namespace opossum {
+
+// Joins orders and lineitem on the order key at scale factor 0.1, argument is the number of workers (0 runs the
+// join without a scheduler)
+static void BM_JoinHashOrdersLineItem(benchmark::State& state) {
+  const auto generator = TpchTableGenerator{0.1f};
+  auto orders = std::make_shared<TableWrapper>(generator.generate_table(TpchTable::Orders));
+  auto line_item = std::make_shared<TableWrapper>(generator.generate_table(TpchTable::LineItem));
+  orders->execute();
+  line_item->execute();
+
+  if (state.range(0) > 0) CurrentScheduler::set(std::make_shared<TaskQueueScheduler>(state.range(0)));
+
+  for (auto _ : state) {
+    auto join = std::make_shared<JoinHash>(orders, line_item, std::make_pair(ColumnID{0}, ColumnID{0}));
+    join->execute();
+    benchmark::DoNotOptimize(join->get_output()->row_count());
+  }
+
+  CurrentScheduler::set(nullptr);
+  const auto input_row_count = orders->get_output()->row_count() + line_item->get_output()->row_count();
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * input_row_count));
+}
+BENCHMARK(BM_JoinHashOrdersLineItem)->Arg(0)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+}  // namespace opossum
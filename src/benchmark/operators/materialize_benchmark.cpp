@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <utility>
+
+#include "operators/join_hash.hpp"
+#include "operators/materialize.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "utils/tpch_table_generator.hpp"
+
+namespace opossum {
+
+// Materializes the result of joining orders and lineitem on the order key at scale factor 0.1. The positions of the
+// join output are scattered across the chunks of both inputs. The argument tells whether the inputs are
+// dictionary-compressed.
+static void BM_MaterializeJoinOrdersLineItem(benchmark::State& state) {
+  const auto generator = TpchTableGenerator{0.1f};
+  const auto orders_table = generator.generate_table(TpchTable::Orders);
+  const auto line_item_table = generator.generate_table(TpchTable::LineItem);
+  if (state.range(0)) {
+    for (const auto& table : {orders_table, line_item_table}) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) table->compress_chunk(chunk_id);
+    }
+  }
+
+  auto orders = std::make_shared<TableWrapper>(orders_table);
+  auto line_item = std::make_shared<TableWrapper>(line_item_table);
+  orders->execute();
+  line_item->execute();
+  auto join = std::make_shared<JoinHash>(orders, line_item, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  for (auto _ : state) {
+    auto materialize = std::make_shared<Materialize>(join);
+    materialize->execute();
+    benchmark::DoNotOptimize(materialize->get_output()->row_count());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * join->get_output()->row_count()));
+}
+BENCHMARK(BM_MaterializeJoinOrdersLineItem)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "expression/arithmetic_expression.hpp"
+#include "expression/column_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/pipeline_executor.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "utils/tpch_table_generator.hpp"
+
+namespace opossum {
+
+// A query similar to TPC-H query 1 on lineitem at scale factor 0.1: scan, projection of a computed column and
+// aggregate. The argument tells whether the plan is executed pipelined (1) or operator by operator (0).
+static void BM_PipelineExecutorScanProjectAggregate(benchmark::State& state) {
+  auto line_item = std::make_shared<TableWrapper>(TpchTableGenerator{0.1f}.generate_table(TpchTable::LineItem));
+  line_item->execute();
+
+  const auto column = [](const uint16_t column_id) { return std::make_shared<ColumnExpression>(ColumnID{column_id}); };
+
+  for (auto _ : state) {
+    // WHERE l_shipdate <= '1998-09-02' AND l_quantity < 40
+    auto ship_date_scan =
+        std::make_shared<TableScan>(line_item, ColumnID{10}, ScanType::OpLessThanEquals, "1998-09-02");
+    auto quantity_scan = std::make_shared<TableScan>(ship_date_scan, ColumnID{4}, ScanType::OpLessThan, 40.0f);
+    // l_returnflag, l_extendedprice * (1 - l_discount)
+    const auto discounted_price = std::make_shared<ArithmeticExpression>(
+        ArithmeticOperator::Multiplication, column(5),
+        std::make_shared<ArithmeticExpression>(ArithmeticOperator::Subtraction,
+                                               std::make_shared<ValueExpression>(1.0f), column(6)));
+    auto projection = std::make_shared<Projection>(
+        quantity_scan, std::vector<std::shared_ptr<AbstractExpression>>{column(8), discounted_price});
+    auto aggregate = std::make_shared<Aggregate>(
+        projection, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}},
+        std::vector<ColumnID>{ColumnID{0}});
+
+    if (state.range(0)) {
+      PipelineExecutor{aggregate}.execute();
+    } else {
+      ship_date_scan->execute();
+      quantity_scan->execute();
+      projection->execute();
+      aggregate->execute();
+    }
+    benchmark::DoNotOptimize(aggregate->get_output()->row_count());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * line_item->get_output()->row_count()));
+}
+BENCHMARK(BM_PipelineExecutorScanProjectAggregate)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
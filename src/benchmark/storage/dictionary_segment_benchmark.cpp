@@ -0,0 +1,187 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "micro_benchmark_utils.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/task_queue_scheduler.hpp"
+#include "storage/dictionary_merge.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+std::shared_ptr<ValueSegment<T>> create_value_segment(const size_t row_count, const size_t distinct_values) {
+  auto value_segment = std::make_shared<ValueSegment<T>>();
+  for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+    value_segment->append(make_benchmark_value<T>(row_index, distinct_values));
+  }
+  return value_segment;
+}
+
+constexpr auto ACCESS_ROW_COUNT = size_t{100'000};
+constexpr auto MERGE_ROW_COUNT = size_t{10'000};
+constexpr auto PARALLEL_CONSTRUCTION_ROW_COUNT = size_t{4'000'000};
+
+}  // namespace
+
+// Builds a dictionary segment, arguments are the number of rows and the number of distinct values
+template <typename T>
+static void BM_DictionarySegmentConstruction(benchmark::State& state) {
+  const auto row_count = static_cast<size_t>(state.range(0));
+  const auto value_segment = create_value_segment<T>(row_count, static_cast<size_t>(state.range(1)));
+
+  for (auto _ : state) {
+    const auto dictionary_segment = DictionarySegment<T>{value_segment};
+    benchmark::DoNotOptimize(dictionary_segment.unique_values_count());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * row_count));
+}
+
+#define DICTIONARY_CONSTRUCTION_BENCHMARK(type)                \
+  BENCHMARK_TEMPLATE(BM_DictionarySegmentConstruction, type)   \
+      ->ArgNames({"rows", "distinct"})                         \
+      ->ArgsProduct({{100'000}, {10, 1'000, 100'000}})         \
+      ->Unit(benchmark::kMicrosecond)
+
+DICTIONARY_CONSTRUCTION_BENCHMARK(int32_t);
+DICTIONARY_CONSTRUCTION_BENCHMARK(int64_t);
+DICTIONARY_CONSTRUCTION_BENCHMARK(float);
+DICTIONARY_CONSTRUCTION_BENCHMARK(double);
+DICTIONARY_CONSTRUCTION_BENCHMARK(std::string);
+
+// Builds one large dictionary segment with a scheduler of the given number of workers
+static void BM_DictionarySegmentParallelConstruction(benchmark::State& state) {
+  const auto value_segment = create_value_segment<int32_t>(PARALLEL_CONSTRUCTION_ROW_COUNT, 100'000);
+  CurrentScheduler::set(std::make_shared<TaskQueueScheduler>(static_cast<uint32_t>(state.range(0))));
+
+  for (auto _ : state) {
+    const auto dictionary_segment = DictionarySegment<int32_t>{value_segment};
+    benchmark::DoNotOptimize(dictionary_segment.unique_values_count());
+  }
+
+  CurrentScheduler::set(nullptr);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * PARALLEL_CONSTRUCTION_ROW_COUNT));
+}
+BENCHMARK(BM_DictionarySegmentParallelConstruction)
+    ->ArgName("workers")
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Concatenates 16 dictionary segments, once by merging their dictionaries and once by decompressing them and building
+// a new dictionary segment. The argument is the number of distinct values per segment.
+static void BM_DictionarySegmentMerge(benchmark::State& state) {
+  auto segments = std::vector<std::shared_ptr<BaseSegment>>{};
+  auto segment_pointers = std::vector<const BaseSegment*>{};
+  for (auto segment_index = 0; segment_index < 16; ++segment_index) {
+    segments.push_back(std::make_shared<DictionarySegment<int32_t>>(
+        create_value_segment<int32_t>(MERGE_ROW_COUNT, static_cast<size_t>(state.range(0)))));
+    segment_pointers.push_back(segments.back().get());
+  }
+
+  for (auto _ : state) {
+    const auto merged = merge_dictionary_segments(segment_pointers, DataType::Int, std::pmr::get_default_resource());
+    benchmark::DoNotOptimize(merged->size());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * segments.size() * MERGE_ROW_COUNT));
+}
+BENCHMARK(BM_DictionarySegmentMerge)->Arg(100)->Arg(10'000)->Unit(benchmark::kMicrosecond);
+
+static void BM_DictionarySegmentRecompress(benchmark::State& state) {
+  auto segments = std::vector<std::shared_ptr<DictionarySegment<int32_t>>>{};
+  for (auto segment_index = 0; segment_index < 16; ++segment_index) {
+    segments.push_back(std::make_shared<DictionarySegment<int32_t>>(
+        create_value_segment<int32_t>(MERGE_ROW_COUNT, static_cast<size_t>(state.range(0)))));
+  }
+
+  for (auto _ : state) {
+    auto values = std::make_shared<ValueSegment<int32_t>>();
+    for (const auto& segment : segments) {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+        values->append(segment->get(chunk_offset));
+      }
+    }
+    const auto merged = DictionarySegment<int32_t>{values};
+    benchmark::DoNotOptimize(merged.size());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * segments.size() * MERGE_ROW_COUNT));
+}
+BENCHMARK(BM_DictionarySegmentRecompress)->Arg(100)->Arg(10'000)->Unit(benchmark::kMicrosecond);
+
+// The following benchmarks sum up all values of a segment, once through the virtual operator[] that returns an
+// AllTypeVariant and once through the typed accessors.
+static void BM_ValueSegmentSubscriptOperator(benchmark::State& state) {
+  const auto value_segment = create_value_segment<int32_t>(ACCESS_ROW_COUNT, 1'000);
+  const BaseSegment& base_segment = *value_segment;
+
+  for (auto _ : state) {
+    auto sum = int64_t{0};
+    for (ChunkOffset chunk_offset{0}; chunk_offset < ACCESS_ROW_COUNT; ++chunk_offset) {
+      sum += boost::get<int32_t>(base_segment[chunk_offset]);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ACCESS_ROW_COUNT));
+}
+BENCHMARK(BM_ValueSegmentSubscriptOperator);
+
+static void BM_ValueSegmentTypedAccess(benchmark::State& state) {
+  const auto value_segment = create_value_segment<int32_t>(ACCESS_ROW_COUNT, 1'000);
+
+  for (auto _ : state) {
+    auto sum = int64_t{0};
+    for (const auto value : value_segment->values()) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ACCESS_ROW_COUNT));
+}
+BENCHMARK(BM_ValueSegmentTypedAccess);
+
+static void BM_DictionarySegmentSubscriptOperator(benchmark::State& state) {
+  const auto dictionary_segment =
+      DictionarySegment<int32_t>{create_value_segment<int32_t>(ACCESS_ROW_COUNT, 1'000)};
+  const BaseSegment& base_segment = dictionary_segment;
+
+  for (auto _ : state) {
+    auto sum = int64_t{0};
+    for (ChunkOffset chunk_offset{0}; chunk_offset < ACCESS_ROW_COUNT; ++chunk_offset) {
+      sum += boost::get<int32_t>(base_segment[chunk_offset]);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ACCESS_ROW_COUNT));
+}
+BENCHMARK(BM_DictionarySegmentSubscriptOperator);
+
+static void BM_DictionarySegmentTypedAccess(benchmark::State& state) {
+  const auto dictionary_segment =
+      DictionarySegment<int32_t>{create_value_segment<int32_t>(ACCESS_ROW_COUNT, 1'000)};
+
+  for (auto _ : state) {
+    auto sum = int64_t{0};
+    for (ChunkOffset chunk_offset{0}; chunk_offset < ACCESS_ROW_COUNT; ++chunk_offset) {
+      sum += dictionary_segment.get(chunk_offset);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ACCESS_ROW_COUNT));
+}
+BENCHMARK(BM_DictionarySegmentTypedAccess);
+
+}  // namespace opossum
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "storage/base_attribute_vector.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto ATTRIBUTE_VECTOR_SIZE = size_t{1'000'000};
+
+}  // namespace
+
+// Reads all value ids through the virtual interface of BaseAttributeVector, templated by the width
+template <typename T>
+static void BM_FixedSizeAttributeVectorGet(benchmark::State& state) {
+  const auto attribute_vector = std::make_shared<FixedSizeAttributeVector<T>>(ATTRIBUTE_VECTOR_SIZE);
+  const BaseAttributeVector& base_attribute_vector = *attribute_vector;
+
+  for (auto _ : state) {
+    auto sum = uint64_t{0};
+    for (auto index = size_t{0}; index < ATTRIBUTE_VECTOR_SIZE; ++index) sum += base_attribute_vector.get(index);
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ATTRIBUTE_VECTOR_SIZE));
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * ATTRIBUTE_VECTOR_SIZE * sizeof(T)));
+}
+BENCHMARK_TEMPLATE(BM_FixedSizeAttributeVectorGet, uint8_t);
+BENCHMARK_TEMPLATE(BM_FixedSizeAttributeVectorGet, uint16_t);
+BENCHMARK_TEMPLATE(BM_FixedSizeAttributeVectorGet, uint32_t);
+
+// Writes all value ids through the virtual interface of BaseAttributeVector, templated by the width
+template <typename T>
+static void BM_FixedSizeAttributeVectorSet(benchmark::State& state) {
+  const auto attribute_vector = std::make_shared<FixedSizeAttributeVector<T>>(ATTRIBUTE_VECTOR_SIZE);
+  BaseAttributeVector& base_attribute_vector = *attribute_vector;
+
+  for (auto _ : state) {
+    for (auto index = size_t{0}; index < ATTRIBUTE_VECTOR_SIZE; ++index) {
+      base_attribute_vector.set(index, ValueID{static_cast<T>(index)});
+    }
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ATTRIBUTE_VECTOR_SIZE));
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * ATTRIBUTE_VECTOR_SIZE * sizeof(T)));
+}
+BENCHMARK_TEMPLATE(BM_FixedSizeAttributeVectorSet, uint8_t);
+BENCHMARK_TEMPLATE(BM_FixedSizeAttributeVectorSet, uint16_t);
+BENCHMARK_TEMPLATE(BM_FixedSizeAttributeVectorSet, uint32_t);
+
+// Reads all value ids through the typed values() accessor for comparison
+template <typename T>
+static void BM_FixedSizeAttributeVectorTypedRead(benchmark::State& state) {
+  const auto attribute_vector = std::make_shared<FixedSizeAttributeVector<T>>(ATTRIBUTE_VECTOR_SIZE);
+
+  for (auto _ : state) {
+    auto sum = uint64_t{0};
+    for (const auto value_id : attribute_vector->values()) sum += value_id;
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ATTRIBUTE_VECTOR_SIZE));
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * ATTRIBUTE_VECTOR_SIZE * sizeof(T)));
+}
+BENCHMARK_TEMPLATE(BM_FixedSizeAttributeVectorTypedRead, uint8_t);
+BENCHMARK_TEMPLATE(BM_FixedSizeAttributeVectorTypedRead, uint16_t);
+BENCHMARK_TEMPLATE(BM_FixedSizeAttributeVectorTypedRead, uint32_t);
+
+}  // namespace opossum
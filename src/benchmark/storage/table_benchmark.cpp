@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "micro_benchmark_utils.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/counting_memory_resource.hpp"
+
+namespace opossum {
+
+// Appends rows of an int and a string column. The arguments select whether chunks use their own arena and whether
+// large blocks come from huge pages, which are not counted as allocations.
+static void BM_TableAppend(benchmark::State& state) {
+  const auto use_chunk_arenas = static_cast<bool>(state.range(0));
+  const auto use_huge_pages = static_cast<bool>(state.range(1));
+  constexpr auto row_count = size_t{100'000};
+
+  CountingMemoryResource memory_resource;
+  for (auto _ : state) {
+    Table table{10'000, &memory_resource, use_chunk_arenas, use_huge_pages};
+    table.add_column("a", "int");
+    table.add_column("b", "string");
+    for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+      table.append({static_cast<int32_t>(row_index), make_benchmark_value<std::string>(row_index, 1'000)});
+    }
+    benchmark::DoNotOptimize(table.row_count());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * row_count));
+  report_allocations(state, memory_resource);
+}
+BENCHMARK(BM_TableAppend)->ArgNames({"arenas", "huge_pages"})->ArgsProduct({{0, 1}, {0, 1}});
+
+// Sums an int column of 8M rows in chunks of 1M rows, which are allocated from chunk arenas with or without huge
+// pages. The segments are far larger than the range covered by the TLB with regular pages.
+static void BM_TableScanChunkArenas(benchmark::State& state) {
+  const auto use_huge_pages = static_cast<bool>(state.range(0));
+  constexpr auto chunk_size = uint32_t{1'000'000};
+  constexpr auto chunk_count = size_t{8};
+
+  Table table{chunk_size, std::pmr::get_default_resource(), true, use_huge_pages};
+  table.add_column("a", "int");
+  for (auto row_index = size_t{0}; row_index < chunk_size * chunk_count; ++row_index) {
+    table.append({make_benchmark_value<int32_t>(row_index, 1'000)});
+  }
+
+  for (auto _ : state) {
+    auto sum = int64_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto segment = table.get_chunk_snapshot(chunk_id)->get_segment(ColumnID{0});
+      for (const auto value : static_cast<const ValueSegment<int32_t>&>(*segment).values()) sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * chunk_size * chunk_count));
+}
+BENCHMARK(BM_TableScanChunkArenas)->ArgName("huge_pages")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Compresses a single chunk, arguments are the chunk size and the number of columns. Columns are compressed in
+// parallel, so wall time is measured.
+static void BM_TableCompressChunk(benchmark::State& state) {
+  const auto chunk_size = static_cast<uint32_t>(state.range(0));
+  const auto column_count = static_cast<size_t>(state.range(1));
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    Table table{chunk_size};
+    for (auto column_index = size_t{0}; column_index < column_count; ++column_index) {
+      table.add_column("column_" + std::to_string(column_index), "int");
+    }
+    auto row = std::vector<AllTypeVariant>(column_count);
+    for (auto row_index = size_t{0}; row_index < chunk_size; ++row_index) {
+      for (auto& value : row) value = make_benchmark_value<int32_t>(row_index, 1'000);
+      table.append(row);
+    }
+    state.ResumeTiming();
+
+    table.compress_chunk(ChunkID{0});
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * chunk_size * column_count));
+}
+BENCHMARK(BM_TableCompressChunk)
+    ->ArgNames({"chunk_size", "columns"})
+    ->ArgsProduct({{10'000, 100'000, 1'000'000}, {1, 4, 16}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+// the linter wants this to be above everything else
+#include <filesystem>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "micro_benchmark_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+// Loads a generated .tbl file with an int, a float, and a string column, argument is the number of rows
+static void BM_LoadTable(benchmark::State& state) {
+  const auto row_count = static_cast<size_t>(state.range(0));
+  const auto file_name = (std::filesystem::temp_directory_path() / "hyrise_load_table_benchmark.tbl").string();
+
+  {
+    std::ofstream file(file_name);
+    file << "a|b|c\nint|float|string\n";
+    for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+      file << row_index << "|" << make_benchmark_value<float>(row_index, 1'000) + 0.5f << "|"
+           << make_benchmark_value<std::string>(row_index, 1'000) << "\n";
+    }
+  }
+
+  for (auto _ : state) {
+    const auto table = load_table(file_name, 10'000);
+    benchmark::DoNotOptimize(table->row_count());
+  }
+
+  std::remove(file_name.c_str());
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * row_count));
+}
+BENCHMARK(BM_LoadTable)->Arg(100'000)->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
@@ -0,0 +1,23 @@
+#include <benchmark/benchmark.h>
+
+#include "storage/table.hpp"
+#include "utils/tpch_table_generator.hpp"
+
+namespace opossum {
+
+// Generates lineitem at scale factor 0.1, argument is the number of threads
+static void BM_TpchTableGeneratorLineItem(benchmark::State& state) {
+  const auto generator = TpchTableGenerator{0.1f, 100'000, 0, static_cast<uint32_t>(state.range(0))};
+
+  auto row_count = uint64_t{0};
+  for (auto _ : state) {
+    const auto table = generator.generate_table(TpchTable::LineItem);
+    row_count = table->row_count();
+    benchmark::DoNotOptimize(row_count);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * row_count));
+}
+BENCHMARK(BM_TpchTableGeneratorLineItem)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+}  // namespace opossum
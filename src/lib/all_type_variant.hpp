@@ -4,6 +4,7 @@
 #include <boost/hana/pair.hpp>
 #include <boost/hana/prepend.hpp>
 #include <boost/hana/second.hpp>
+#include <boost/hana/size.hpp>
 #include <boost/hana/transform.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/zip.hpp>
@@ -68,6 +69,11 @@ using AllTypeVariant = typename boost::make_variant_over<detail::TypesAsMplVecto
 static constexpr auto types = detail::types;
 static constexpr auto data_types = detail::data_types;
 
+// Enum representation of the data types, in the same order as in data_types. Resolving a DataType does not need any
+// string comparisons, which is why tables cache their column types as DataType.
+enum class DataType : uint8_t { Int, Long, Float, Double, String };
+static_assert(decltype(hana::size(types))::value == 5, "DataType needs to be updated along with data_types");
+
 using AllTypeVariant = detail::AllTypeVariant;
 
 /**
@@ -0,0 +1,25 @@
+#include "abstract_expression.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+AbstractExpression::AbstractExpression(const ExpressionType type,
+                                       const std::vector<std::shared_ptr<AbstractExpression>>& arguments)
+    : _type(type), _arguments(arguments) {}
+
+ExpressionType AbstractExpression::type() const { return _type; }
+
+const std::vector<std::shared_ptr<AbstractExpression>>& AbstractExpression::arguments() const { return _arguments; }
+
+std::string AbstractExpression::_argument_description(const size_t argument_id, const Table& table) const {
+  const auto& argument = *_arguments[argument_id];
+  if (argument.type() == ExpressionType::Column || argument.type() == ExpressionType::Value) {
+    return argument.description(table);
+  }
+  return "(" + argument.description(table) + ")";
+}
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class ExpressionType { Column, Value, Arithmetic, Comparison, Logical, Case };
+
+/**
+ * An expression computes one value per row of a table, e.g., a * b + c. Expressions form a tree, whose leaves are
+ * columns and values. They are evaluated by the ExpressionEvaluator.
+ *
+ * Comparisons and logical expressions are predicates. Used as values, they evaluate to 1 (true) or 0 (false), as
+ * there is no boolean data type. Likewise, any numeric expression can be used as a predicate, which is true if the
+ * value is not 0.
+ */
+class AbstractExpression {
+ public:
+  AbstractExpression(const ExpressionType type, const std::vector<std::shared_ptr<AbstractExpression>>& arguments);
+  virtual ~AbstractExpression() = default;
+
+  ExpressionType type() const;
+  const std::vector<std::shared_ptr<AbstractExpression>>& arguments() const;
+
+  // returns the data type of the values when the expression is evaluated on the given table
+  virtual DataType data_type(const Table& table) const = 0;
+
+  // returns a readable representation of the expression, e.g., "a * (b + 1)". It is used as column name.
+  virtual std::string description(const Table& table) const = 0;
+
+ protected:
+  // returns the description of an argument, in parentheses unless it is a column or a value
+  std::string _argument_description(const size_t argument_id, const Table& table) const;
+
+  const ExpressionType _type;
+  const std::vector<std::shared_ptr<AbstractExpression>> _arguments;
+};
+
+}  // namespace opossum
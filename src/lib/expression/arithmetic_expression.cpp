@@ -0,0 +1,59 @@
+#include "arithmetic_expression.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ArithmeticExpression::ArithmeticExpression(const ArithmeticOperator arithmetic_operator,
+                                           const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right)
+    : AbstractExpression(ExpressionType::Arithmetic, {left, right}), _arithmetic_operator(arithmetic_operator) {}
+
+ArithmeticOperator ArithmeticExpression::arithmetic_operator() const { return _arithmetic_operator; }
+
+const std::shared_ptr<AbstractExpression>& ArithmeticExpression::left() const { return _arguments[0]; }
+
+const std::shared_ptr<AbstractExpression>& ArithmeticExpression::right() const { return _arguments[1]; }
+
+DataType ArithmeticExpression::data_type(const Table& table) const {
+  auto data_type = std::optional<DataType>{};
+  resolve_data_type(left()->data_type(table), [&](auto left_type) {
+    using LeftType = typename decltype(left_type)::type;
+    resolve_data_type(right()->data_type(table), [&](auto right_type) {
+      using RightType = typename decltype(right_type)::type;
+      if constexpr (std::is_arithmetic_v<LeftType> && std::is_arithmetic_v<RightType>) {
+        data_type = data_type_of<decltype(std::declval<LeftType>() + std::declval<RightType>())>;
+      }
+    });
+  });
+  Assert(data_type, "Arithmetic expressions need numeric arguments");
+  return *data_type;
+}
+
+std::string ArithmeticExpression::description(const Table& table) const {
+  auto operator_string = std::string{};
+  switch (_arithmetic_operator) {
+    case ArithmeticOperator::Addition:
+      operator_string = " + ";
+      break;
+    case ArithmeticOperator::Subtraction:
+      operator_string = " - ";
+      break;
+    case ArithmeticOperator::Multiplication:
+      operator_string = " * ";
+      break;
+    case ArithmeticOperator::Division:
+      operator_string = " / ";
+      break;
+  }
+  return _argument_description(0, table) + operator_string + _argument_description(1, table);
+}
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+enum class ArithmeticOperator { Addition, Subtraction, Multiplication, Division };
+
+/**
+ * An arithmetic operation on two numeric expressions. The result has the type that C++ uses for the operation, e.g.,
+ * long for int + long and float for long * float. Integer division truncates towards zero, and dividing an integer by
+ * zero fails.
+ */
+class ArithmeticExpression : public AbstractExpression {
+ public:
+  ArithmeticExpression(const ArithmeticOperator arithmetic_operator, const std::shared_ptr<AbstractExpression>& left,
+                       const std::shared_ptr<AbstractExpression>& right);
+
+  ArithmeticOperator arithmetic_operator() const;
+  const std::shared_ptr<AbstractExpression>& left() const;
+  const std::shared_ptr<AbstractExpression>& right() const;
+
+  DataType data_type(const Table& table) const override;
+  std::string description(const Table& table) const override;
+
+ protected:
+  const ArithmeticOperator _arithmetic_operator;
+};
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#include "case_expression.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CaseExpression::CaseExpression(const std::shared_ptr<AbstractExpression>& when,
+                               const std::shared_ptr<AbstractExpression>& then,
+                               const std::shared_ptr<AbstractExpression>& otherwise)
+    : AbstractExpression(ExpressionType::Case, {when, then, otherwise}) {}
+
+const std::shared_ptr<AbstractExpression>& CaseExpression::when() const { return _arguments[0]; }
+
+const std::shared_ptr<AbstractExpression>& CaseExpression::then() const { return _arguments[1]; }
+
+const std::shared_ptr<AbstractExpression>& CaseExpression::otherwise() const { return _arguments[2]; }
+
+DataType CaseExpression::data_type(const Table& table) const {
+  auto data_type = std::optional<DataType>{};
+  resolve_data_type(then()->data_type(table), [&](auto then_type) {
+    using ThenType = typename decltype(then_type)::type;
+    resolve_data_type(otherwise()->data_type(table), [&](auto otherwise_type) {
+      using OtherwiseType = typename decltype(otherwise_type)::type;
+      if constexpr (std::is_same_v<ThenType, OtherwiseType>) {
+        data_type = data_type_of<ThenType>;
+      } else if constexpr (std::is_arithmetic_v<ThenType> && std::is_arithmetic_v<OtherwiseType>) {  // NOLINT
+        data_type = data_type_of<std::common_type_t<ThenType, OtherwiseType>>;
+      }
+    });
+  });
+  Assert(data_type, "THEN and ELSE need to be both numeric or both strings");
+  return *data_type;
+}
+
+std::string CaseExpression::description(const Table& table) const {
+  return "CASE WHEN " + when()->description(table) + " THEN " + then()->description(table) + " ELSE " +
+         otherwise()->description(table) + " END";
+}
+
+}  // namespace opossum
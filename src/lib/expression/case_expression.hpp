@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+/**
+ * CASE WHEN when THEN then ELSE otherwise END. Then and otherwise either both have to be numeric or both have to be
+ * strings. Each of them is only evaluated for the rows for which it is chosen. Several WHEN clauses are expressed by
+ * nesting CaseExpressions in otherwise.
+ */
+class CaseExpression : public AbstractExpression {
+ public:
+  CaseExpression(const std::shared_ptr<AbstractExpression>& when, const std::shared_ptr<AbstractExpression>& then,
+                 const std::shared_ptr<AbstractExpression>& otherwise);
+
+  const std::shared_ptr<AbstractExpression>& when() const;
+  const std::shared_ptr<AbstractExpression>& then() const;
+  const std::shared_ptr<AbstractExpression>& otherwise() const;
+
+  DataType data_type(const Table& table) const override;
+  std::string description(const Table& table) const override;
+};
+
+}  // namespace opossum
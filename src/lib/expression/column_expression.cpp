@@ -0,0 +1,18 @@
+#include "column_expression.hpp"
+
+#include <string>
+
+#include "storage/table.hpp"
+
+namespace opossum {
+
+ColumnExpression::ColumnExpression(const ColumnID column_id)
+    : AbstractExpression(ExpressionType::Column, {}), _column_id(column_id) {}
+
+ColumnID ColumnExpression::column_id() const { return _column_id; }
+
+DataType ColumnExpression::data_type(const Table& table) const { return table.column_data_type(_column_id); }
+
+std::string ColumnExpression::description(const Table& table) const { return table.column_name(_column_id); }
+
+}  // namespace opossum
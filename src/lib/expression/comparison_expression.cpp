@@ -0,0 +1,51 @@
+#include "comparison_expression.hpp"
+
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ComparisonExpression::ComparisonExpression(const ScanType scan_type, const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right)
+    : AbstractExpression(ExpressionType::Comparison, {left, right}), _scan_type(scan_type) {}
+
+ScanType ComparisonExpression::scan_type() const { return _scan_type; }
+
+const std::shared_ptr<AbstractExpression>& ComparisonExpression::left() const { return _arguments[0]; }
+
+const std::shared_ptr<AbstractExpression>& ComparisonExpression::right() const { return _arguments[1]; }
+
+DataType ComparisonExpression::data_type(const Table& table) const {
+  Assert((left()->data_type(table) == DataType::String) == (right()->data_type(table) == DataType::String),
+         "Cannot compare strings with numbers");
+  return DataType::Int;
+}
+
+std::string ComparisonExpression::description(const Table& table) const {
+  auto operator_string = std::string{};
+  switch (_scan_type) {
+    case ScanType::OpEquals:
+      operator_string = " = ";
+      break;
+    case ScanType::OpNotEquals:
+      operator_string = " != ";
+      break;
+    case ScanType::OpLessThan:
+      operator_string = " < ";
+      break;
+    case ScanType::OpLessThanEquals:
+      operator_string = " <= ";
+      break;
+    case ScanType::OpGreaterThan:
+      operator_string = " > ";
+      break;
+    case ScanType::OpGreaterThanEquals:
+      operator_string = " >= ";
+      break;
+  }
+  return _argument_description(0, table) + operator_string + _argument_description(1, table);
+}
+
+}  // namespace opossum
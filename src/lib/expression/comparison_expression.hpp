@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+// Compares two expressions, which either both have to be numeric or both have to be strings
+class ComparisonExpression : public AbstractExpression {
+ public:
+  ComparisonExpression(const ScanType scan_type, const std::shared_ptr<AbstractExpression>& left,
+                       const std::shared_ptr<AbstractExpression>& right);
+
+  ScanType scan_type() const;
+  const std::shared_ptr<AbstractExpression>& left() const;
+  const std::shared_ptr<AbstractExpression>& right() const;
+
+  DataType data_type(const Table& table) const override;
+  std::string description(const Table& table) const override;
+
+ protected:
+  const ScanType _scan_type;
+};
+
+}  // namespace opossum
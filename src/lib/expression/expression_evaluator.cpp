@@ -0,0 +1,362 @@
+#include "expression_evaluator.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arithmetic_expression.hpp"
+#include "case_expression.hpp"
+#include "column_expression.hpp"
+#include "comparison_expression.hpp"
+#include "logical_expression.hpp"
+#include "resolve_type.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "value_expression.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T, typename Operator>
+void arithmetic_kernel(const std::vector<T>& left, const std::vector<T>& right, std::vector<T>& result,
+                       const Operator& op) {
+  const auto size = result.size();
+  for (auto index = size_t{0}; index < size; ++index) {
+    result[index] = static_cast<T>(op(left[index], right[index]));
+  }
+}
+
+// returns the rows that are not part of selected, which is a subset of rows
+ExpressionEvaluator::Selection complement(const ExpressionEvaluator::Selection& rows,
+                                          const ExpressionEvaluator::Selection& selected) {
+  auto unselected = ExpressionEvaluator::Selection{};
+  unselected.reserve(rows.size() - selected.size());
+  std::set_difference(rows.begin(), rows.end(), selected.begin(), selected.end(), std::back_inserter(unselected));
+  return unselected;
+}
+
+}  // namespace
+
+ExpressionEvaluator::ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id)
+    : _table(table), _chunk_id(chunk_id) {}
+
+std::shared_ptr<BaseSegment> ExpressionEvaluator::evaluate_to_segment(const AbstractExpression& expression) const {
+  return evaluate_to_segment(expression, _all_rows());
+}
+
+std::shared_ptr<BaseSegment> ExpressionEvaluator::evaluate_to_segment(const AbstractExpression& expression,
+                                                                      const Selection& rows) const {
+  auto segment = std::shared_ptr<BaseSegment>{};
+
+  resolve_data_type(expression.data_type(*_table), [&](auto type) {
+    using ExpressionDataType = typename decltype(type)::type;
+    auto values = pmr_vector<ExpressionDataType>{};
+    values.reserve(rows.size());
+
+    auto batch_rows = Selection{};
+    auto batch_values = std::vector<SegmentValue<ExpressionDataType>>{};
+    for (auto batch_begin = size_t{0}; batch_begin < rows.size(); batch_begin += BATCH_SIZE) {
+      batch_rows.assign(rows.begin() + batch_begin, rows.begin() + std::min(batch_begin + BATCH_SIZE, rows.size()));
+      _evaluate<ExpressionDataType>(expression, batch_rows, batch_values);
+      values.insert(values.end(), batch_values.begin(), batch_values.end());
+    }
+
+    segment = std::make_shared<ValueSegment<ExpressionDataType>>(std::move(values));
+  });
+
+  return segment;
+}
+
+ExpressionEvaluator::Selection ExpressionEvaluator::evaluate_to_selection(const AbstractExpression& expression) const {
+  return evaluate_to_selection(expression, _all_rows());
+}
+
+ExpressionEvaluator::Selection ExpressionEvaluator::evaluate_to_selection(const AbstractExpression& expression,
+                                                                          const Selection& rows) const {
+  auto selection = Selection{};
+
+  auto batch_rows = Selection{};
+  for (auto batch_begin = size_t{0}; batch_begin < rows.size(); batch_begin += BATCH_SIZE) {
+    batch_rows.assign(rows.begin() + batch_begin, rows.begin() + std::min(batch_begin + BATCH_SIZE, rows.size()));
+    const auto batch_selection = _select(expression, batch_rows);
+    selection.insert(selection.end(), batch_selection.begin(), batch_selection.end());
+  }
+
+  return selection;
+}
+
+ExpressionEvaluator::Selection ExpressionEvaluator::_all_rows() const {
+  auto rows = Selection(_table->get_chunk_snapshot(_chunk_id)->size());
+  std::iota(rows.begin(), rows.end(), ChunkOffset{0});
+  return rows;
+}
+
+template <typename T>
+void ExpressionEvaluator::_evaluate(const AbstractExpression& expression, const Selection& rows,
+                                    std::vector<SegmentValue<T>>& result) const {
+  result.resize(rows.size());
+
+  switch (expression.type()) {
+    case ExpressionType::Column:
+      _evaluate_column<T>(static_cast<const ColumnExpression&>(expression).column_id(), rows, result);
+      return;
+
+    case ExpressionType::Value: {
+      // Strings are viewed in place, the expression outlives the evaluation
+      const auto& value = static_cast<const ValueExpression&>(expression).value();
+      std::fill(result.begin(), result.end(), SegmentValue<T>{boost::get<T>(value)});
+      return;
+    }
+
+    case ExpressionType::Arithmetic:
+      _evaluate_arithmetic<T>(expression, rows, result);
+      return;
+
+    case ExpressionType::Comparison:
+    case ExpressionType::Logical:
+      if constexpr (std::is_arithmetic_v<T>) {
+        const auto selected = _select(expression, rows);
+        auto selected_index = size_t{0};
+        for (auto index = size_t{0}; index < rows.size(); ++index) {
+          const auto is_selected = selected_index < selected.size() && selected[selected_index] == rows[index];
+          result[index] = is_selected ? T{1} : T{0};
+          selected_index += is_selected;
+        }
+      } else {
+        Fail("Predicates evaluate to numbers");
+      }
+      return;
+
+    case ExpressionType::Case:
+      _evaluate_case<T>(expression, rows, result);
+      return;
+  }
+  Fail("Unknown expression type");
+}
+
+template <typename T>
+void ExpressionEvaluator::_evaluate_converted(const AbstractExpression& expression, const Selection& rows,
+                                              std::vector<SegmentValue<T>>& result) const {
+  resolve_data_type(expression.data_type(*_table), [&](auto type) {
+    using ExpressionDataType = typename decltype(type)::type;
+    if constexpr (std::is_same_v<ExpressionDataType, T>) {
+      _evaluate<T>(expression, rows, result);
+    } else if constexpr (std::is_arithmetic_v<ExpressionDataType> && std::is_arithmetic_v<T>) {  // NOLINT
+      auto values = std::vector<ExpressionDataType>{};
+      _evaluate<ExpressionDataType>(expression, rows, values);
+      result.resize(values.size());
+      std::transform(values.begin(), values.end(), result.begin(),
+                     [](const ExpressionDataType value) { return static_cast<T>(value); });
+    } else {
+      Fail("Cannot convert between strings and numbers");
+    }
+  });
+}
+
+template <typename T>
+void ExpressionEvaluator::_evaluate_column(const ColumnID column_id, const Selection& rows,
+                                           std::vector<SegmentValue<T>>& result) const {
+  const auto segment_ptr = _table->get_chunk_snapshot(_chunk_id)->get_segment(column_id);
+  const auto& segment = *segment_ptr;
+
+  if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    // The referenced segment is resolved once per run of rows that point into the same chunk
+    const auto& pos_list = *reference_segment->pos_list();
+    const auto& referenced_table = *reference_segment->referenced_table();
+    const auto referenced_column_id = reference_segment->referenced_column_id();
+
+    auto run_begin = size_t{0};
+    while (run_begin < rows.size()) {
+      const auto chunk_id = pos_list[rows[run_begin]].chunk_id;
+      auto run_end = run_begin + 1;
+      while (run_end < rows.size() && pos_list[rows[run_end]].chunk_id == chunk_id) ++run_end;
+
+      const auto referenced_segment_ptr =
+          referenced_table.get_chunk_snapshot(chunk_id)->get_segment(referenced_column_id);
+      const auto& referenced_segment = *referenced_segment_ptr;
+      resolve_segment_type<T>(referenced_segment, [&](const auto& typed_segment) {
+        for (auto index = run_begin; index < run_end; ++index) {
+          result[index] = segment_value<T>(typed_segment, pos_list[rows[index]].chunk_offset);
+        }
+      });
+      run_begin = run_end;
+    }
+    return;
+  }
+
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+      const auto& values = typed_segment.values();
+      for (auto index = size_t{0}; index < rows.size(); ++index) result[index] = values[rows[index]];
+    } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {  // NOLINT
+      const auto& dictionary = *typed_segment.dictionary();
+      resolve_attribute_vector_type(*typed_segment.attribute_vector(), [&](const auto& attribute_vector) {
+        const auto& value_ids = attribute_vector.values();
+        for (auto index = size_t{0}; index < rows.size(); ++index) result[index] = dictionary[value_ids[rows[index]]];
+      });
+    } else {
+      for (auto index = size_t{0}; index < rows.size(); ++index) {
+        result[index] = segment_value<T>(typed_segment, rows[index]);
+      }
+    }
+  });
+}
+
+template <typename T>
+void ExpressionEvaluator::_evaluate_arithmetic(const AbstractExpression& expression, const Selection& rows,
+                                               std::vector<SegmentValue<T>>& result) const {
+  if constexpr (std::is_arithmetic_v<T>) {
+    const auto& arithmetic_expression = static_cast<const ArithmeticExpression&>(expression);
+
+    // Both sides are converted to the type of the result first, as C++ does it
+    auto left_values = std::vector<T>{};
+    auto right_values = std::vector<T>{};
+    _evaluate_converted<T>(*arithmetic_expression.left(), rows, left_values);
+    _evaluate_converted<T>(*arithmetic_expression.right(), rows, right_values);
+
+    switch (arithmetic_expression.arithmetic_operator()) {
+      case ArithmeticOperator::Addition:
+        arithmetic_kernel(left_values, right_values, result, std::plus<>{});
+        return;
+      case ArithmeticOperator::Subtraction:
+        arithmetic_kernel(left_values, right_values, result, std::minus<>{});
+        return;
+      case ArithmeticOperator::Multiplication:
+        arithmetic_kernel(left_values, right_values, result, std::multiplies<>{});
+        return;
+      case ArithmeticOperator::Division:
+        if constexpr (std::is_integral_v<T>) {
+          Assert(std::find(right_values.begin(), right_values.end(), T{0}) == right_values.end(), "Division by zero");
+        }
+        arithmetic_kernel(left_values, right_values, result, std::divides<>{});
+        return;
+    }
+  } else {
+    Fail("Arithmetic expressions need numeric arguments");
+  }
+}
+
+template <typename T>
+void ExpressionEvaluator::_evaluate_case(const AbstractExpression& expression, const Selection& rows,
+                                         std::vector<SegmentValue<T>>& result) const {
+  const auto& case_expression = static_cast<const CaseExpression&>(expression);
+
+  const auto then_rows = _select(*case_expression.when(), rows);
+  const auto otherwise_rows = complement(rows, then_rows);
+
+  auto then_values = std::vector<SegmentValue<T>>{};
+  auto otherwise_values = std::vector<SegmentValue<T>>{};
+  _evaluate_converted<T>(*case_expression.then(), then_rows, then_values);
+  _evaluate_converted<T>(*case_expression.otherwise(), otherwise_rows, otherwise_values);
+
+  auto then_index = size_t{0};
+  auto otherwise_index = size_t{0};
+  for (auto index = size_t{0}; index < rows.size(); ++index) {
+    if (then_index < then_rows.size() && then_rows[then_index] == rows[index]) {
+      result[index] = then_values[then_index++];
+    } else {
+      result[index] = otherwise_values[otherwise_index++];
+    }
+  }
+}
+
+ExpressionEvaluator::Selection ExpressionEvaluator::_select(const AbstractExpression& expression,
+                                                            const Selection& rows) const {
+  if (rows.empty()) return {};
+
+  switch (expression.type()) {
+    case ExpressionType::Logical: {
+      const auto& logical_expression = static_cast<const LogicalExpression&>(expression);
+      const auto left_rows = _select(*logical_expression.left(), rows);
+      if (logical_expression.logical_operator() == LogicalOperator::And) {
+        return _select(*logical_expression.right(), left_rows);
+      }
+
+      const auto right_rows = _select(*logical_expression.right(), complement(rows, left_rows));
+      auto selected = Selection{};
+      selected.reserve(left_rows.size() + right_rows.size());
+      std::merge(left_rows.begin(), left_rows.end(), right_rows.begin(), right_rows.end(),
+                 std::back_inserter(selected));
+      return selected;
+    }
+
+    case ExpressionType::Comparison:
+      return _select_comparison(expression, rows);
+
+    default: {
+      // Any other expression is true if its value is not 0
+      auto selected = Selection{};
+      resolve_data_type(expression.data_type(*_table), [&](auto type) {
+        using ExpressionDataType = typename decltype(type)::type;
+        if constexpr (std::is_arithmetic_v<ExpressionDataType>) {
+          auto values = std::vector<ExpressionDataType>{};
+          _evaluate<ExpressionDataType>(expression, rows, values);
+          for (auto index = size_t{0}; index < rows.size(); ++index) {
+            if (values[index] != ExpressionDataType{0}) selected.push_back(rows[index]);
+          }
+        } else {
+          Fail("Strings cannot be used as predicates");
+        }
+      });
+      return selected;
+    }
+  }
+}
+
+ExpressionEvaluator::Selection ExpressionEvaluator::_select_comparison(const AbstractExpression& expression,
+                                                                       const Selection& rows) const {
+  const auto& comparison_expression = static_cast<const ComparisonExpression&>(expression);
+  const auto& left = *comparison_expression.left();
+  const auto& right = *comparison_expression.right();
+
+  // Writes every row and advances the end of the selection only if the row matches, which avoids branches
+  auto selected = Selection(rows.size());
+  auto selected_count = size_t{0};
+  const auto compare_as = [&](auto type) {
+    using ComparisonType = typename decltype(type)::type;
+    auto left_values = std::vector<SegmentValue<ComparisonType>>{};
+    auto right_values = std::vector<SegmentValue<ComparisonType>>{};
+    _evaluate_converted<ComparisonType>(left, rows, left_values);
+    _evaluate_converted<ComparisonType>(right, rows, right_values);
+
+    resolve_scan_type(comparison_expression.scan_type(), [&](auto compare) {
+      for (auto index = size_t{0}; index < rows.size(); ++index) {
+        selected[selected_count] = rows[index];
+        selected_count += compare(left_values[index], right_values[index]);
+      }
+    });
+  };
+
+  const auto left_data_type = left.data_type(*_table);
+  const auto right_data_type = right.data_type(*_table);
+  if (left_data_type == DataType::String || right_data_type == DataType::String) {
+    Assert(left_data_type == right_data_type, "Cannot compare strings with numbers");
+    compare_as(hana::type_c<std::string>);
+  } else {
+    // Numbers are compared in their common type, as C++ does it
+    resolve_data_type(left_data_type, [&](auto left_type) {
+      using LeftType = typename decltype(left_type)::type;
+      resolve_data_type(right_data_type, [&](auto right_type) {
+        using RightType = typename decltype(right_type)::type;
+        if constexpr (std::is_arithmetic_v<LeftType> && std::is_arithmetic_v<RightType>) {
+          compare_as(hana::type_c<std::common_type_t<LeftType, RightType>>);
+        }
+      });
+    });
+  }
+
+  selected.resize(selected_count);
+  return selected;
+}
+
+}  // namespace opossum
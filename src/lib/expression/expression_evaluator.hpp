@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_expression.hpp"
+#include "storage/segment_iterate.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Table;
+
+/**
+ * Evaluates expressions on the rows of a chunk. The chunk is processed in batches of BATCH_SIZE rows, so that the
+ * intermediate results stay in the cache. Within a batch, every node of the expression tree is evaluated for all
+ * rows at once into a typed buffer, with one kernel instantiation per combination of data types. This way, the loops
+ * over the rows do not contain any virtual calls or type switches.
+ *
+ * Predicates produce selection vectors, i.e., the rows of the batch for which they are true. The arguments of AND,
+ * OR and CASE are only evaluated on the rows that are still undecided, e.g., the right side of an AND only on the
+ * rows for which the left side is true.
+ */
+class ExpressionEvaluator {
+ public:
+  static constexpr auto BATCH_SIZE = ChunkOffset{1'024};
+
+  // The rows of a chunk, in ascending order
+  using Selection = std::vector<ChunkOffset>;
+
+  ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id);
+
+  // evaluates an expression for all rows of the chunk and returns the result as a ValueSegment
+  std::shared_ptr<BaseSegment> evaluate_to_segment(const AbstractExpression& expression) const;
+
+  // same as above, but only for the given rows, e.g., those that passed a filter before
+  std::shared_ptr<BaseSegment> evaluate_to_segment(const AbstractExpression& expression, const Selection& rows) const;
+
+  // returns the rows of the chunk for which a predicate is true
+  Selection evaluate_to_selection(const AbstractExpression& expression) const;
+
+  // returns the subset of the given rows for which a predicate is true
+  Selection evaluate_to_selection(const AbstractExpression& expression, const Selection& rows) const;
+
+ protected:
+  Selection _all_rows() const;
+
+  // evaluates an expression of data type T for the given rows into result, which gets one value per row
+  template <typename T>
+  void _evaluate(const AbstractExpression& expression, const Selection& rows,
+                 std::vector<SegmentValue<T>>& result) const;
+
+  // evaluates an expression of any data type and converts the values to T. Both need to be numeric or strings.
+  template <typename T>
+  void _evaluate_converted(const AbstractExpression& expression, const Selection& rows,
+                           std::vector<SegmentValue<T>>& result) const;
+
+  template <typename T>
+  void _evaluate_column(const ColumnID column_id, const Selection& rows, std::vector<SegmentValue<T>>& result) const;
+
+  template <typename T>
+  void _evaluate_arithmetic(const AbstractExpression& expression, const Selection& rows,
+                            std::vector<SegmentValue<T>>& result) const;
+
+  template <typename T>
+  void _evaluate_case(const AbstractExpression& expression, const Selection& rows,
+                      std::vector<SegmentValue<T>>& result) const;
+
+  // returns the subset of rows for which a predicate is true
+  Selection _select(const AbstractExpression& expression, const Selection& rows) const;
+
+  Selection _select_comparison(const AbstractExpression& expression, const Selection& rows) const;
+
+  const std::shared_ptr<const Table> _table;
+  const ChunkID _chunk_id;
+};
+
+}  // namespace opossum
@@ -0,0 +1,26 @@
+#include "logical_expression.hpp"
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+LogicalExpression::LogicalExpression(const LogicalOperator logical_operator,
+                                     const std::shared_ptr<AbstractExpression>& left,
+                                     const std::shared_ptr<AbstractExpression>& right)
+    : AbstractExpression(ExpressionType::Logical, {left, right}), _logical_operator(logical_operator) {}
+
+LogicalOperator LogicalExpression::logical_operator() const { return _logical_operator; }
+
+const std::shared_ptr<AbstractExpression>& LogicalExpression::left() const { return _arguments[0]; }
+
+const std::shared_ptr<AbstractExpression>& LogicalExpression::right() const { return _arguments[1]; }
+
+DataType LogicalExpression::data_type(const Table&) const { return DataType::Int; }
+
+std::string LogicalExpression::description(const Table& table) const {
+  const auto operator_string = _logical_operator == LogicalOperator::And ? " AND " : " OR ";
+  return _argument_description(0, table) + operator_string + _argument_description(1, table);
+}
+
+}  // namespace opossum
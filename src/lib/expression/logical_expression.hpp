@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+enum class LogicalOperator { And, Or };
+
+// Combines two predicates. The right predicate is only evaluated for the rows for which the left one does not
+// already decide the result.
+class LogicalExpression : public AbstractExpression {
+ public:
+  LogicalExpression(const LogicalOperator logical_operator, const std::shared_ptr<AbstractExpression>& left,
+                    const std::shared_ptr<AbstractExpression>& right);
+
+  LogicalOperator logical_operator() const;
+  const std::shared_ptr<AbstractExpression>& left() const;
+  const std::shared_ptr<AbstractExpression>& right() const;
+
+  DataType data_type(const Table& table) const override;
+  std::string description(const Table& table) const override;
+
+ protected:
+  const LogicalOperator _logical_operator;
+};
+
+}  // namespace opossum
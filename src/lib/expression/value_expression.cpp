@@ -0,0 +1,24 @@
+#include "value_expression.hpp"
+
+#include <string>
+
+#include "type_cast.hpp"
+
+namespace opossum {
+
+ValueExpression::ValueExpression(const AllTypeVariant& value)
+    : AbstractExpression(ExpressionType::Value, {}), _value(value) {}
+
+const AllTypeVariant& ValueExpression::value() const { return _value; }
+
+DataType ValueExpression::data_type(const Table&) const {
+  // The types of AllTypeVariant are in the same order as DataType
+  return static_cast<DataType>(_value.which());
+}
+
+std::string ValueExpression::description(const Table& table) const {
+  const auto value_string = type_cast<std::string>(_value);
+  return data_type(table) == DataType::String ? "'" + value_string + "'" : value_string;
+}
+
+}  // namespace opossum
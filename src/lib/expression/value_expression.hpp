@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+// A constant value, e.g., the 1 in a + 1
+class ValueExpression : public AbstractExpression {
+ public:
+  explicit ValueExpression(const AllTypeVariant& value);
+
+  const AllTypeVariant& value() const;
+
+  DataType data_type(const Table& table) const override;
+  std::string description(const Table& table) const override;
+
+ protected:
+  const AllTypeVariant _value;
+};
+
+}  // namespace opossum
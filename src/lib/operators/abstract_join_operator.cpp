@@ -0,0 +1,39 @@
+#include "abstract_join_operator.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractJoinOperator::AbstractJoinOperator(const std::shared_ptr<AbstractOperator> left,
+                                           const std::shared_ptr<AbstractOperator> right,
+                                           const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractOperator(left, right), _column_ids(column_ids), _scan_type(scan_type) {}
+
+const std::pair<ColumnID, ColumnID>& AbstractJoinOperator::column_ids() const { return _column_ids; }
+
+ScanType AbstractJoinOperator::scan_type() const { return _scan_type; }
+
+std::shared_ptr<const Table> AbstractJoinOperator::_build_output(
+    const std::shared_ptr<const PosList>& left_pos_list, const std::shared_ptr<const PosList>& right_pos_list) const {
+  DebugAssert(left_pos_list->size() == right_pos_list->size(), "Position lists need to have the same size");
+
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+
+  auto output = std::make_shared<Table>();
+  _add_output_columns(*left_table, *output);
+  _add_output_columns(*right_table, *output);
+
+  auto output_chunk = Chunk{};
+  _add_reference_segments(left_table, left_pos_list, output_chunk);
+  _add_reference_segments(right_table, right_pos_list, output_chunk);
+  output->emplace_chunk(std::move(output_chunk));
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Base class for joins of two inputs on one column each. The output consists of the columns of the left input
+// followed by the columns of the right input and references the matching rows of both inputs.
+class AbstractJoinOperator : public AbstractOperator {
+ public:
+  AbstractJoinOperator(const std::shared_ptr<AbstractOperator> left, const std::shared_ptr<AbstractOperator> right,
+                       const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+  const std::pair<ColumnID, ColumnID>& column_ids() const;
+  ScanType scan_type() const;
+
+ protected:
+  // creates the output table from the matching rows, left_pos_list[i] joins with right_pos_list[i]
+  std::shared_ptr<const Table> _build_output(const std::shared_ptr<const PosList>& left_pos_list,
+                                             const std::shared_ptr<const PosList>& right_pos_list) const;
+
+  const std::pair<ColumnID, ColumnID> _column_ids;
+  const ScanType _scan_type;
+};
+
+}  // namespace opossum
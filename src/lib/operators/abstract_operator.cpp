@@ -0,0 +1,84 @@
+#include "abstract_operator.hpp"
+
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractOperator::AbstractOperator(const std::shared_ptr<AbstractOperator> left,
+                                   const std::shared_ptr<AbstractOperator> right)
+    : _input_left(left), _input_right(right) {}
+
+void AbstractOperator::execute() {
+  Assert(!_output, "Operator " + name() + " was already executed");
+  DebugAssert(!_input_left || _input_left->get_output(), "Left input has not been executed");
+  DebugAssert(!_input_right || _input_right->get_output(), "Right input has not been executed");
+
+  const auto start = std::chrono::steady_clock::now();
+  _output = _on_execute();
+  _performance_data.walltime = std::chrono::steady_clock::now() - start;
+}
+
+std::shared_ptr<const Table> AbstractOperator::get_output() const { return _output; }
+
+std::shared_ptr<AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
+
+std::shared_ptr<AbstractOperator> AbstractOperator::input_right() const { return _input_right; }
+
+const OperatorPerformanceData& AbstractOperator::performance_data() const { return _performance_data; }
+
+std::shared_ptr<const Table> AbstractOperator::_input_table_left() const { return _input_left->get_output(); }
+
+std::shared_ptr<const Table> AbstractOperator::_input_table_right() const { return _input_right->get_output(); }
+
+void AbstractOperator::_add_output_columns(const Table& input_table, Table& output_table) {
+  for (auto column_id = ColumnID{0}; column_id < input_table.column_count(); ++column_id) {
+    output_table.add_column(input_table.column_name(column_id), input_table.column_type(column_id));
+  }
+}
+
+void AbstractOperator::_add_reference_segments(const std::shared_ptr<const Table>& input_table,
+                                               const std::shared_ptr<const PosList>& pos_list, Chunk& output_chunk) {
+  // Columns that come from the same input (e.g., one side of a join) share their position lists. In that case, we
+  // resolve the positions only once.
+  auto previous_input_pos_lists = std::vector<std::shared_ptr<const PosList>>{};
+  auto resolved_pos_list = std::shared_ptr<const PosList>{};
+
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    const auto first_segment = input_table->get_chunk_snapshot(ChunkID{0})->get_segment(column_id);
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(first_segment);
+    if (!reference_segment) {
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+      continue;
+    }
+
+    auto input_pos_lists = std::vector<std::shared_ptr<const PosList>>{};
+    input_pos_lists.reserve(input_table->chunk_count());
+    for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      const auto segment = input_table->get_chunk_snapshot(chunk_id)->get_segment(column_id);
+      DebugAssert(std::dynamic_pointer_cast<const ReferenceSegment>(segment), "Cannot mix segment types in a column");
+      input_pos_lists.push_back(std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list());
+    }
+
+    if (input_pos_lists != previous_input_pos_lists) {
+      auto positions = std::make_shared<PosList>();
+      positions->reserve(pos_list->size());
+      for (const auto& row_id : *pos_list) {
+        positions->push_back((*input_pos_lists[row_id.chunk_id])[row_id.chunk_offset]);
+      }
+      resolved_pos_list = positions;
+      previous_input_pos_lists = std::move(input_pos_lists);
+    }
+
+    output_chunk.add_segment(std::make_shared<ReferenceSegment>(
+        reference_segment->referenced_table(), reference_segment->referenced_column_id(), resolved_pos_list));
+  }
+}
+
+}  // namespace opossum
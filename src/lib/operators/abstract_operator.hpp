@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// Measurements that every operator takes while it executes
+struct OperatorPerformanceData {
+  std::chrono::nanoseconds walltime{0};
+};
+
+// AbstractOperator is the abstract super class for all operators.
+// All operators have up to two input tables and one output table.
+// Their lifecycle has three phases:
+// 1. The operator is constructed. Previous operators are not guaranteed to have been executed, so operators must not
+// call get_output in their execute method
+// 2. The execute method is called from the outside (usually by the scheduler, see OperatorTask). This is where the
+// heavy lifting is done. By now, the input operators have already been executed.
+// 3. The consumer (usually another operator) calls get_output. This should be very cheap. It is only guaranteed to
+// succeed if execute was called before. Otherwise, a nullptr or an empty table could be returned.
+//
+// Operators shall not be executed twice. The output table is immutable.
+class AbstractOperator : private Noncopyable {
+ public:
+  AbstractOperator(const std::shared_ptr<AbstractOperator> left = nullptr,
+                   const std::shared_ptr<AbstractOperator> right = nullptr);
+
+  virtual ~AbstractOperator() = default;
+
+  void execute();
+
+  // returns the result of the operator
+  std::shared_ptr<const Table> get_output() const;
+
+  // returns the name of the operator, e.g., for printing query plans
+  virtual const std::string name() const = 0;
+
+  std::shared_ptr<AbstractOperator> input_left() const;
+  std::shared_ptr<AbstractOperator> input_right() const;
+
+  // valid once the operator was executed
+  const OperatorPerformanceData& performance_data() const;
+
+ protected:
+  // Executes fused operators itself and stores their output
+  friend class PipelineExecutor;
+
+  // abstract method to actually execute the operator
+  // execute and get_output are split into two methods to allow for easier
+  // asynchronous execution
+  virtual std::shared_ptr<const Table> _on_execute() = 0;
+
+  std::shared_ptr<const Table> _input_table_left() const;
+  std::shared_ptr<const Table> _input_table_right() const;
+
+  // adds the columns of input_table to output_table, without any data
+  static void _add_output_columns(const Table& input_table, Table& output_table);
+
+  // Adds a ReferenceSegment for every column of input_table to output_chunk, pointing to the rows in pos_list. If
+  // input_table consists of ReferenceSegments itself, the positions are resolved, so that the output always
+  // references data tables.
+  static void _add_reference_segments(const std::shared_ptr<const Table>& input_table,
+                                      const std::shared_ptr<const PosList>& pos_list, Chunk& output_chunk);
+
+  // Shared pointers to input operators, can be nullptr.
+  const std::shared_ptr<AbstractOperator> _input_left;
+  const std::shared_ptr<AbstractOperator> _input_right;
+
+  // Is nullptr until the operator is executed
+  std::shared_ptr<const Table> _output;
+
+  OperatorPerformanceData _performance_data;
+};
+
+}  // namespace opossum
@@ -0,0 +1,627 @@
+#include "aggregate.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "group_key.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_queue_scheduler.hpp"
+#include "storage/hyper_log_log.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Number of ValueIDs up to which value_id_histogram compares vectors of uint8_t ValueIDs against every ValueID with
+// SIMD instructions instead of incrementing a counter per row
+constexpr auto MAX_SIMD_HISTOGRAM_VALUE_IDS = size_t{16};
+
+// Adds the number of occurrences of every ValueID to counts, which has one entry per ValueID
+template <typename ValueIDType>
+void value_id_histogram(const pmr_vector<ValueIDType>& value_ids, std::vector<int64_t>& counts) {
+  for (const auto value_id : value_ids) ++counts[value_id];
+}
+
+template <>
+void value_id_histogram(const pmr_vector<uint8_t>& value_ids, std::vector<int64_t>& counts) {
+  const auto* data = value_ids.data();
+  const auto size = value_ids.size();
+  auto offset = size_t{0};
+
+#if defined(__SSE2__)
+  if (counts.size() <= MAX_SIMD_HISTOGRAM_VALUE_IDS) {
+    // Every comparison yields -1 in the matching byte lanes, which are subtracted from 8-bit counters. These are
+    // summed up before they can overflow, i.e., after at most 255 blocks of 16 ValueIDs. The blocks of a batch stay
+    // in the L1 cache while they are compared against every ValueID.
+    constexpr auto BLOCK_SIZE = sizeof(__m128i);
+    constexpr auto MAX_BATCH_BLOCKS = size_t{255};
+    const auto block_count = size / BLOCK_SIZE;
+    for (auto batch_begin = size_t{0}; batch_begin < block_count; batch_begin += MAX_BATCH_BLOCKS) {
+      const auto batch_end = std::min(batch_begin + MAX_BATCH_BLOCKS, block_count);
+      for (auto value_id = size_t{0}; value_id < counts.size(); ++value_id) {
+        const auto needle = _mm_set1_epi8(static_cast<char>(value_id));
+        auto lane_counts = _mm_setzero_si128();
+        for (auto block = batch_begin; block < batch_end; ++block) {
+          const auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + block * BLOCK_SIZE));
+          lane_counts = _mm_sub_epi8(lane_counts, _mm_cmpeq_epi8(values, needle));
+        }
+        // Sums up the eight lower and the eight upper lanes into two 16-bit values
+        const auto sums = _mm_sad_epu8(lane_counts, _mm_setzero_si128());
+        counts[value_id] += _mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4);
+      }
+    }
+    offset = block_count * BLOCK_SIZE;
+  }
+#endif
+
+  // Four interleaved histograms, so that consecutive increments of the same counter do not wait for each other
+  auto partial_counts = std::vector<std::array<uint32_t, 4>>(counts.size());
+  for (; offset + 4 <= size; offset += 4) {
+    ++partial_counts[data[offset]][0];
+    ++partial_counts[data[offset + 1]][1];
+    ++partial_counts[data[offset + 2]][2];
+    ++partial_counts[data[offset + 3]][3];
+  }
+  for (; offset < size; ++offset) ++partial_counts[data[offset]][0];
+  for (auto value_id = size_t{0}; value_id < counts.size(); ++value_id) {
+    const auto& partial_count = partial_counts[value_id];
+    counts[value_id] += partial_count[0] + partial_count[1] + partial_count[2] + partial_count[3];
+  }
+}
+
+// Pre-aggregation of a chunk that is grouped by a single column stored in a DictionarySegment. As the ValueIDs are
+// dense, they directly serve as group ids, and the aggregates are dense arrays indexed by ValueID instead of hash
+// tables. These arrays are only used if the dictionary has no more entries than the chunk has rows (which a shared
+// dictionary may), so that they are not larger than a hash table would be. The groups are counted by a histogram over
+// the ValueIDs; the group ids of the rows are only materialized if other aggregates need them. Returns false if the
+// segment is not a DictionarySegment, otherwise dictionary is set to the dictionary that the group ids refer to.
+template <typename T>
+bool group_by_value_ids(const BaseSegment& segment, const bool needs_group_ids, std::vector<std::string>& keys,
+                        std::vector<uint32_t>& group_ids, std::vector<int64_t>& group_counts,
+                        const void*& dictionary) {
+  const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment);
+  if (!dictionary_segment) return false;
+  const auto group_count = dictionary_segment->unique_values_count();
+  if (group_count > dictionary_segment->size()) return false;
+
+  group_counts.resize(group_count);
+  resolve_attribute_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+    const auto& value_ids = attribute_vector.values();
+    value_id_histogram(value_ids, group_counts);
+    if (needs_group_ids) group_ids.assign(value_ids.begin(), value_ids.end());
+  });
+
+  // The values are only looked up once per group, and only for values that occur in the chunk
+  keys.resize(group_count);
+  for (auto value_id = ValueID::base_type{0}; value_id < group_count; ++value_id) {
+    if (group_counts[value_id] == 0) continue;
+    append_key_part<T>(keys[value_id], dictionary_segment->value_by_value_id(ValueID{value_id}));
+  }
+  dictionary = dictionary_segment->dictionary().get();
+  return true;
+}
+
+// Type of the output column of an aggregate
+DataType aggregate_data_type(const AggregateFunction function, const DataType input_data_type) {
+  switch (function) {
+    case AggregateFunction::Count:
+      return DataType::Long;
+    case AggregateFunction::Sum:
+      return input_data_type == DataType::Int || input_data_type == DataType::Long ? DataType::Long : DataType::Double;
+    case AggregateFunction::Avg:
+      return DataType::Double;
+    case AggregateFunction::Min:
+    case AggregateFunction::Max:
+      return input_data_type;
+  }
+  Fail("Unknown aggregate function");
+  return {};
+}
+
+std::string aggregate_function_to_string(const AggregateFunction function) {
+  switch (function) {
+    case AggregateFunction::Count:
+      return "COUNT";
+    case AggregateFunction::Sum:
+      return "SUM";
+    case AggregateFunction::Min:
+      return "MIN";
+    case AggregateFunction::Max:
+      return "MAX";
+    case AggregateFunction::Avg:
+      return "AVG";
+  }
+  Fail("Unknown aggregate function");
+  return {};
+}
+
+// The intermediate results of one aggregate for all groups of a hash table, indexed by group id
+class BaseAggregateResult {
+ public:
+  virtual ~BaseAggregateResult() = default;
+
+  virtual std::unique_ptr<BaseAggregateResult> create_empty() const = 0;
+
+  virtual void resize(size_t group_count) = 0;
+
+  // Aggregates the rows of a segment into the groups given by group_ids, which holds one group id per row.
+  // COUNT does not need to read the segment, so it may be a nullptr.
+  virtual void aggregate(const BaseSegment* segment, const std::vector<uint32_t>& group_ids) = 0;
+
+  // Adds the number of rows of every group to a COUNT aggregate
+  virtual void aggregate_counts(const std::vector<int64_t>& group_counts) = 0;
+
+  // Adds the group other_group_id of another result to the group group_id of this result
+  virtual void merge(const BaseAggregateResult& other, size_t other_group_id, size_t group_id) = 0;
+
+  virtual std::shared_ptr<BaseSegment> output_segment() = 0;
+};
+
+template <typename T>
+class AggregateResult : public BaseAggregateResult {
+ public:
+  using SumType = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+
+  explicit AggregateResult(const AggregateFunction function) : _function(function) {}
+
+  std::unique_ptr<BaseAggregateResult> create_empty() const override {
+    return std::make_unique<AggregateResult<T>>(_function);
+  }
+
+  void resize(size_t group_count) override {
+    _counts.resize(group_count);
+    if (_function == AggregateFunction::Sum || _function == AggregateFunction::Avg) _sums.resize(group_count);
+    if (_function == AggregateFunction::Min || _function == AggregateFunction::Max) _extremes.resize(group_count);
+  }
+
+  void aggregate(const BaseSegment* segment, const std::vector<uint32_t>& group_ids) override {
+    switch (_function) {
+      case AggregateFunction::Count:
+        for (const auto group_id : group_ids) ++_counts[group_id];
+        break;
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        if constexpr (std::is_arithmetic_v<T>) {
+          segment_for_each<T>(*segment, [&](const ChunkOffset chunk_offset, const T value) {
+            const auto group_id = group_ids[chunk_offset];
+            ++_counts[group_id];
+            _sums[group_id] += value;
+          });
+        } else {
+          Fail("SUM and AVG are not available for strings");
+        }
+        break;
+      case AggregateFunction::Min:
+        _aggregate_extreme(*segment, group_ids, std::less<>{});
+        break;
+      case AggregateFunction::Max:
+        _aggregate_extreme(*segment, group_ids, std::greater<>{});
+        break;
+    }
+  }
+
+  void aggregate_counts(const std::vector<int64_t>& group_counts) override {
+    DebugAssert(_function == AggregateFunction::Count, "Only COUNT can be computed from the group counts");
+    for (auto group_id = size_t{0}; group_id < group_counts.size(); ++group_id) {
+      _counts[group_id] += group_counts[group_id];
+    }
+  }
+
+  void merge(const BaseAggregateResult& other, size_t other_group_id, size_t group_id) override {
+    const auto& typed_other = static_cast<const AggregateResult<T>&>(other);
+    const auto other_count = typed_other._counts[other_group_id];
+    if (other_count == 0) return;
+
+    if (_function == AggregateFunction::Sum || _function == AggregateFunction::Avg) {
+      _sums[group_id] += typed_other._sums[other_group_id];
+    } else if (_function == AggregateFunction::Min || _function == AggregateFunction::Max) {
+      const auto& other_extreme = typed_other._extremes[other_group_id];
+      const auto is_better = _function == AggregateFunction::Min ? other_extreme < _extremes[group_id]
+                                                                  : _extremes[group_id] < other_extreme;
+      if (_counts[group_id] == 0 || is_better) _extremes[group_id] = other_extreme;
+    }
+    _counts[group_id] += other_count;
+  }
+
+  std::shared_ptr<BaseSegment> output_segment() override {
+    switch (_function) {
+      case AggregateFunction::Count:
+        return std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>(_counts.begin(), _counts.end()));
+      case AggregateFunction::Sum:
+        return std::make_shared<ValueSegment<SumType>>(pmr_vector<SumType>(_sums.begin(), _sums.end()));
+      case AggregateFunction::Avg: {
+        auto averages = pmr_vector<double>(_counts.size());
+        for (auto group_id = size_t{0}; group_id < _counts.size(); ++group_id) {
+          // Without group by columns, an empty input still results in one group
+          if (_counts[group_id] > 0) averages[group_id] = static_cast<double>(_sums[group_id]) / _counts[group_id];
+        }
+        return std::make_shared<ValueSegment<double>>(std::move(averages));
+      }
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        return std::make_shared<ValueSegment<T>>(pmr_vector<T>(_extremes.begin(), _extremes.end()));
+    }
+    Fail("Unknown aggregate function");
+    return nullptr;
+  }
+
+ protected:
+  template <typename Comparator>
+  void _aggregate_extreme(const BaseSegment& segment, const std::vector<uint32_t>& group_ids,
+                          const Comparator& is_better) {
+    segment_for_each<T>(segment, [&](const ChunkOffset chunk_offset, const SegmentValue<T>& value) {
+      const auto group_id = group_ids[chunk_offset];
+      if (_counts[group_id]++ == 0 || is_better(value, SegmentValue<T>{_extremes[group_id]})) {
+        _extremes[group_id] = T(value);
+      }
+    });
+  }
+
+  const AggregateFunction _function;
+  std::vector<int64_t> _counts;
+  std::vector<SumType> _sums;
+  std::vector<T> _extremes;
+};
+
+// The output column of a group by column, filled from the keys of the groups
+class BaseGroupColumn {
+ public:
+  virtual ~BaseGroupColumn() = default;
+
+  virtual void resize(size_t group_count) = 0;
+
+  // Reads the value of the column from the key at position and advances position to the value of the next column
+  virtual void read(const std::string& key, size_t& position, size_t group_id) = 0;
+
+  virtual std::shared_ptr<BaseSegment> output_segment() = 0;
+};
+
+template <typename T>
+class GroupColumn : public BaseGroupColumn {
+ public:
+  void resize(size_t group_count) override { _values.resize(group_count); }
+
+  void read(const std::string& key, size_t& position, size_t group_id) override {
+    _values[group_id] = read_key_part<T>(key, position);
+  }
+
+  std::shared_ptr<BaseSegment> output_segment() override {
+    return std::make_shared<ValueSegment<T>>(std::move(_values));
+  }
+
+ protected:
+  pmr_vector<T> _values;
+};
+
+// The groups of a hash table, i.e., the pre-aggregated groups of a chunk or the merged groups of a partition
+struct Groups {
+  std::vector<std::string> keys;
+  std::vector<std::unique_ptr<BaseAggregateResult>> results;
+
+  // Only for pre-aggregated chunks: the ids of the groups that belong to each partition
+  std::vector<std::vector<uint32_t>> partitions;
+
+  // Only for chunks that were grouped by ValueIDs: the dictionary that the group ids refer to
+  const void* dictionary = nullptr;
+};
+
+}  // namespace
+
+Aggregate::Aggregate(const std::shared_ptr<AbstractOperator> in,
+                     const std::vector<AggregateColumnDefinition>& aggregates,
+                     const std::vector<ColumnID>& group_by_column_ids)
+    : AbstractOperator(in), _aggregates(aggregates), _group_by_column_ids(group_by_column_ids) {}
+
+const std::vector<AggregateColumnDefinition>& Aggregate::aggregates() const { return _aggregates; }
+
+const std::vector<ColumnID>& Aggregate::group_by_column_ids() const { return _group_by_column_ids; }
+
+const std::string Aggregate::name() const { return "Aggregate"; }
+
+std::shared_ptr<const Table> Aggregate::_on_execute() {
+  const auto input_table = _input_table_left();
+  return _aggregate(*input_table, input_table->chunk_count(), [&](const size_t chunk_index) {
+    return input_table->get_chunk_snapshot(static_cast<ChunkID>(chunk_index));
+  });
+}
+
+std::shared_ptr<const Table> Aggregate::_aggregate(const Table& input_table, const size_t chunk_count,
+                                                   const ChunkProducer& produce_chunk) const {
+  Assert(!_aggregates.empty() || !_group_by_column_ids.empty(), "Aggregate needs aggregates or group by columns");
+
+  auto output_table = std::make_shared<Table>();
+  for (const auto& column_id : _group_by_column_ids) {
+    Assert(column_id < input_table.column_count(), "Group by column does not exist");
+    output_table->add_column(input_table.column_name(column_id), input_table.column_type(column_id));
+  }
+  for (const auto& aggregate : _aggregates) {
+    if (!aggregate.column_id) {
+      Assert(aggregate.function == AggregateFunction::Count, "Only COUNT can be used without a column");
+      output_table->add_column("COUNT(*)", data_type_to_string(DataType::Long));
+      continue;
+    }
+    Assert(*aggregate.column_id < input_table.column_count(), "Aggregate column does not exist");
+    const auto input_data_type = input_table.column_data_type(*aggregate.column_id);
+    Assert(input_data_type != DataType::String ||
+               (aggregate.function != AggregateFunction::Sum && aggregate.function != AggregateFunction::Avg),
+           "SUM and AVG are not available for strings");
+    output_table->add_column(aggregate_function_to_string(aggregate.function) + "(" +
+                                 input_table.column_name(*aggregate.column_id) + ")",
+                             data_type_to_string(aggregate_data_type(aggregate.function, input_data_type)));
+  }
+
+  // COUNT(*) is computed as COUNT of any column, it only needs the group ids
+  const auto create_empty_results = [&]() {
+    auto results = std::vector<std::unique_ptr<BaseAggregateResult>>{};
+    for (const auto& aggregate : _aggregates) {
+      const auto data_type = aggregate.column_id ? input_table.column_data_type(*aggregate.column_id) : DataType::Int;
+      results.emplace_back(
+          make_unique_by_data_type<BaseAggregateResult, AggregateResult>(data_type, aggregate.function));
+    }
+    return results;
+  };
+
+  const auto scheduler = CurrentScheduler::get();
+  const auto partition_count = size_t{scheduler ? scheduler->worker_count() : 1};
+
+  // 1. Pre-aggregate every chunk into its own hash table and partition the resulting groups. Every worker pulls the
+  // next chunk as soon as it is done with the previous one, so that expensive chunks do not hold up the others.
+  auto chunk_groups = std::vector<Groups>(chunk_count);
+  auto next_chunk_index = std::atomic<size_t>{0};
+  const auto aggregate_chunk = [&](const size_t chunk_index) {
+    const auto chunk_pointer = produce_chunk(chunk_index);
+    const auto& chunk = *chunk_pointer;
+    const auto row_count = chunk.size();
+    auto& groups = chunk_groups[chunk_index];
+    groups.results = create_empty_results();
+    groups.partitions.resize(partition_count);
+    if (row_count == 0) return;
+
+    auto needs_group_ids = false;
+    for (const auto& aggregate : _aggregates) needs_group_ids |= aggregate.function != AggregateFunction::Count;
+
+    auto group_ids = std::vector<uint32_t>{};
+    // Only filled by the dense aggregation over ValueIDs, which counts the rows of the groups up front
+    auto group_counts = std::vector<int64_t>{};
+
+    auto is_grouped_by_value_ids = false;
+    if (_group_by_column_ids.size() == 1) {
+      const auto column_id = _group_by_column_ids.front();
+      resolve_data_type(input_table.column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        is_grouped_by_value_ids = group_by_value_ids<ColumnDataType>(*chunk.get_segment(column_id), needs_group_ids,
+                                                                     groups.keys, group_ids, group_counts,
+                                                                     groups.dictionary);
+      });
+    }
+
+    if (_group_by_column_ids.empty()) {
+      groups.keys.emplace_back();
+      group_ids.resize(row_count);
+    } else if (!is_grouped_by_value_ids) {
+      group_ids.resize(row_count);
+      auto row_keys = std::vector<std::string>(row_count);
+
+      // Translates a key part of a group by column from its chunk-local representation into its value. For
+      // DictionarySegments, this replaces the ValueID with the value from the dictionary.
+      using KeyPartTranslator = std::function<void(const std::string&, size_t&, std::string&)>;
+      auto translators = std::vector<KeyPartTranslator>{};
+      auto has_dictionary_segments = false;
+
+      for (const auto& column_id : _group_by_column_ids) {
+        resolve_data_type(input_table.column_data_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          const auto& segment = *chunk.get_segment(column_id);
+
+          if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(&segment)) {
+            resolve_attribute_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+              const auto& value_ids = attribute_vector.values();
+              for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+                const auto value_id = static_cast<ValueID::base_type>(value_ids[chunk_offset]);
+                row_keys[chunk_offset].append(reinterpret_cast<const char*>(&value_id), sizeof(value_id));
+              }
+            });
+            translators.emplace_back([dictionary_segment](const std::string& local_key, size_t& position,
+                                                          std::string& key) {
+              const auto value_id = read_key_part<ValueID::base_type>(local_key, position);
+              append_key_part<ColumnDataType>(key, (*dictionary_segment->dictionary())[value_id]);
+            });
+            has_dictionary_segments = true;
+          } else {
+            segment_for_each<ColumnDataType>(
+                segment, [&](const ChunkOffset chunk_offset, const SegmentValue<ColumnDataType>& value) {
+                  append_key_part<ColumnDataType>(row_keys[chunk_offset], value);
+                });
+            translators.emplace_back([](const std::string& local_key, size_t& position, std::string& key) {
+              const auto begin = position;
+              read_key_part<ColumnDataType>(local_key, position);
+              key.append(local_key, begin, position - begin);
+            });
+          }
+        });
+      }
+
+      auto local_group_ids = std::unordered_map<std::string, uint32_t>{};
+      // If the chunk has distinct sketches for the group by columns, the product of their estimates bounds the number
+      // of groups, so that the hash table does not have to grow
+      auto estimated_group_count = size_t{1};
+      auto has_sketches = true;
+      for (const auto& column_id : _group_by_column_ids) {
+        const auto sketch = chunk.distinct_sketch(column_id);
+        if (!sketch) {
+          has_sketches = false;
+          break;
+        }
+        estimated_group_count = std::min(estimated_group_count * sketch->estimate(), size_t{row_count});
+      }
+      if (has_sketches) {
+        local_group_ids.reserve(estimated_group_count);
+        groups.keys.reserve(estimated_group_count);
+      }
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        const auto next_group_id = static_cast<uint32_t>(local_group_ids.size());
+        auto& row_key = row_keys[chunk_offset];
+        const auto [iter, inserted] = local_group_ids.try_emplace(std::move(row_key), next_group_id);  // NOLINT
+        group_ids[chunk_offset] = iter->second;
+        if (!inserted) continue;
+
+        if (!has_dictionary_segments) {
+          groups.keys.emplace_back(iter->first);
+          continue;
+        }
+        auto key = std::string{};
+        auto position = size_t{0};
+        for (const auto& translator : translators) translator(iter->first, position, key);
+        groups.keys.emplace_back(std::move(key));
+      }
+    }
+
+    for (auto& result : groups.results) result->resize(groups.keys.size());
+    for (auto aggregate_id = size_t{0}; aggregate_id < _aggregates.size(); ++aggregate_id) {
+      const auto column_id = _aggregates[aggregate_id].column_id;
+      const auto* segment = column_id ? chunk.get_segment(*column_id).get() : nullptr;
+      if (_aggregates[aggregate_id].function == AggregateFunction::Count && is_grouped_by_value_ids) {
+        groups.results[aggregate_id]->aggregate_counts(group_counts);
+      } else {
+        groups.results[aggregate_id]->aggregate(segment, group_ids);
+      }
+    }
+
+    const auto hash = std::hash<std::string>{};
+    for (auto group_id = uint32_t{0}; group_id < groups.keys.size(); ++group_id) {
+      // Dictionaries may contain values that no row of the segment refers to, e.g., when they are shared
+      if (is_grouped_by_value_ids && group_counts[group_id] == 0) continue;
+      groups.partitions[hash(groups.keys[group_id]) % partition_count].push_back(group_id);
+    }
+  };
+
+  const auto worker_count = std::min(partition_count, chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      for (auto chunk_index = next_chunk_index++; chunk_index < chunk_count; chunk_index = next_chunk_index++) {
+        aggregate_chunk(chunk_index);
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // If all chunks were grouped by the ValueIDs of the same dictionary, i.e., one that is shared by the chunks of the
+  // column (see Table::share_dictionaries), equal ValueIDs are equal groups. The groups are then merged through an
+  // array indexed by ValueID instead of a hash table over their keys.
+  auto shared_dictionary = static_cast<const void*>(nullptr);
+  auto shared_dictionary_size = size_t{0};
+  auto is_grouped_by_shared_dictionary = true;
+  for (const auto& groups : chunk_groups) {
+    if (groups.keys.empty()) continue;
+    if (!shared_dictionary) {
+      shared_dictionary = groups.dictionary;
+      shared_dictionary_size = groups.keys.size();
+    }
+    is_grouped_by_shared_dictionary &= groups.dictionary && groups.dictionary == shared_dictionary;
+  }
+  is_grouped_by_shared_dictionary &= shared_dictionary != nullptr;
+
+  // 2. Merge the pre-aggregated groups of every partition
+  auto partition_groups = std::vector<Groups>(partition_count);
+  jobs.clear();
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& groups = partition_groups[partition_id];
+      groups.results = create_empty_results();
+
+      auto group_ids = std::unordered_map<std::string, uint32_t>{};
+      auto group_ids_by_value_id = std::vector<uint32_t>(is_grouped_by_shared_dictionary ? shared_dictionary_size : 0,
+                                                         std::numeric_limits<uint32_t>::max());
+      for (auto& local_groups : chunk_groups) {
+        for (const auto local_group_id : local_groups.partitions[partition_id]) {
+          auto& key = local_groups.keys[local_group_id];
+          const auto next_group_id = static_cast<uint32_t>(groups.keys.size());
+          auto group_id = next_group_id;
+          if (is_grouped_by_shared_dictionary) {
+            auto& value_id_group_id = group_ids_by_value_id[local_group_id];
+            if (value_id_group_id == std::numeric_limits<uint32_t>::max()) value_id_group_id = next_group_id;
+            group_id = value_id_group_id;
+          } else {
+            group_id = group_ids.try_emplace(key, next_group_id).first->second;
+          }
+          if (group_id == next_group_id) {
+            groups.keys.emplace_back(std::move(key));
+            for (auto& result : groups.results) result->resize(groups.keys.size());
+          }
+          for (auto aggregate_id = size_t{0}; aggregate_id < _aggregates.size(); ++aggregate_id) {
+            groups.results[aggregate_id]->merge(*local_groups.results[aggregate_id], local_group_id, group_id);
+          }
+        }
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  chunk_groups.clear();
+
+  // Without group by columns, there is exactly one output row, even if the input is empty
+  if (_group_by_column_ids.empty() && std::all_of(partition_groups.cbegin(), partition_groups.cend(),
+                                                  [](const auto& groups) { return groups.keys.empty(); })) {
+    partition_groups[0].keys.emplace_back();
+    for (auto& result : partition_groups[0].results) result->resize(1);
+  }
+
+  // 3. Write the groups of all partitions into the output
+  auto partition_offsets = std::vector<size_t>{0};
+  for (const auto& groups : partition_groups) {
+    partition_offsets.push_back(partition_offsets.back() + groups.keys.size());
+  }
+  const auto group_count = partition_offsets.back();
+
+  auto group_columns = std::vector<std::unique_ptr<BaseGroupColumn>>{};
+  for (const auto& column_id : _group_by_column_ids) {
+    group_columns.emplace_back(
+        make_unique_by_data_type<BaseGroupColumn, GroupColumn>(input_table.column_data_type(column_id)));
+    group_columns.back()->resize(group_count);
+  }
+  auto results = create_empty_results();
+  for (auto& result : results) result->resize(group_count);
+
+  jobs.clear();
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      const auto& groups = partition_groups[partition_id];
+      for (auto group_id = size_t{0}; group_id < groups.keys.size(); ++group_id) {
+        const auto output_group_id = partition_offsets[partition_id] + group_id;
+        auto position = size_t{0};
+        for (auto& group_column : group_columns) group_column->read(groups.keys[group_id], position, output_group_id);
+        for (auto aggregate_id = size_t{0}; aggregate_id < _aggregates.size(); ++aggregate_id) {
+          results[aggregate_id]->merge(*groups.results[aggregate_id], group_id, output_group_id);
+        }
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto output_chunk = Chunk{};
+  for (auto& group_column : group_columns) output_chunk.add_segment(group_column->output_segment());
+  for (auto& result : results) output_chunk.add_segment(result->output_segment());
+  output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+}  // namespace opossum
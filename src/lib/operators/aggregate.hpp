@@ -0,0 +1,66 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class AggregateFunction { Count, Sum, Min, Max, Avg };
+
+// An aggregate over one column of the input. COUNT(*) is expressed as Count without a column.
+struct AggregateColumnDefinition {
+  std::optional<ColumnID> column_id;
+  AggregateFunction function;
+};
+
+/**
+ * Groups the input by the given columns and computes the aggregates for every group (GROUP BY). Without group by
+ * columns, the output consists of a single row, even for an empty input.
+ *
+ * The output consists of the group by columns followed by one column per aggregate, named like "SUM(a)". COUNT
+ * returns a long, SUM returns a long for integral and a double for floating point columns, AVG returns a double, and
+ * MIN and MAX return the type of the input column. SUM and AVG are not available for strings.
+ *
+ * Execution:
+ * 1. Every chunk is pre-aggregated into a small local hash table by one of the workers, which pull the chunks one
+ *    after another. Group by columns that are stored in a DictionarySegment are hashed by their ValueIDs, which are
+ *    only translated into values once per local group.
+ *    If a chunk is grouped by a single column that is stored in a DictionarySegment, no hash table is needed: the
+ *    ValueIDs serve as group ids, and the groups are counted by a histogram over the attribute vector.
+ * 2. The local groups are partitioned by the hash of their key, and every partition is merged by its own job. If all
+ *    chunks were grouped by ValueIDs of the same shared dictionary (see Table::share_dictionaries), the groups are
+ *    merged by their ValueIDs without hashing.
+ */
+class Aggregate : public AbstractOperator {
+ public:
+  Aggregate(const std::shared_ptr<AbstractOperator> in, const std::vector<AggregateColumnDefinition>& aggregates,
+            const std::vector<ColumnID>& group_by_column_ids);
+
+  const std::vector<AggregateColumnDefinition>& aggregates() const;
+  const std::vector<ColumnID>& group_by_column_ids() const;
+
+  const std::string name() const override;
+
+ protected:
+  friend class PipelineExecutor;
+
+  // Returns the chunk with a given index. The chunks may be produced on the fly, e.g., by a pipeline.
+  using ChunkProducer = std::function<std::shared_ptr<const Chunk>(const size_t chunk_index)>;
+
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // Aggregates chunk_count chunks that have the columns of input_table, which only provides the column definitions
+  std::shared_ptr<const Table> _aggregate(const Table& input_table, const size_t chunk_count,
+                                          const ChunkProducer& produce_chunk) const;
+
+  const std::vector<AggregateColumnDefinition> _aggregates;
+  const std::vector<ColumnID> _group_by_column_ids;
+};
+
+}  // namespace opossum
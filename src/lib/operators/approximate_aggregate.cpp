@@ -0,0 +1,261 @@
+#include "approximate_aggregate.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "group_key.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "table_sample.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns z such that a standard normal variable lies in [-z, z] with the given probability. Found by bisection, as
+// the standard library has no inverse of erf.
+double normal_quantile(const double confidence) {
+  auto low = 0.0;
+  auto high = 10.0;
+  for (auto iteration = 0; iteration < 100; ++iteration) {
+    const auto middle = (low + high) / 2.0;
+    if (std::erf(middle / std::sqrt(2.0)) < confidence) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  return (low + high) / 2.0;
+}
+
+std::string aggregate_name(const AggregateColumnDefinition& aggregate, const Table& input_table) {
+  const auto column_name = aggregate.column_id ? input_table.column_name(*aggregate.column_id) : std::string{"*"};
+  switch (aggregate.function) {
+    case AggregateFunction::Count:
+      return "COUNT(" + column_name + ")";
+    case AggregateFunction::Sum:
+      return "SUM(" + column_name + ")";
+    case AggregateFunction::Avg:
+      return "AVG(" + column_name + ")";
+    case AggregateFunction::Min:
+    case AggregateFunction::Max:
+      break;
+  }
+  Fail("MIN and MAX cannot be estimated from a sample");
+  return {};
+}
+
+// Sums over the sampled chunks of the (scaled) totals t of an aggregate and the row counts c of a group in a chunk.
+// Chunks in which the group does not occur add nothing.
+struct ClusterSums {
+  double totals = 0.0;
+  double squared_totals = 0.0;
+  double counts = 0.0;
+  double squared_counts = 0.0;
+  double products = 0.0;
+};
+
+}  // namespace
+
+ApproximateAggregate::ApproximateAggregate(const std::shared_ptr<TableSample>& in,
+                                           const std::vector<AggregateColumnDefinition>& aggregates,
+                                           const std::vector<ColumnID>& group_by_column_ids, const double confidence)
+    : AbstractOperator(in),
+      _sample(in),
+      _aggregates(aggregates),
+      _group_by_column_ids(group_by_column_ids),
+      _confidence(confidence) {
+  Assert(confidence > 0.0 && confidence < 1.0, "The confidence has to be in (0, 1)");
+  for (const auto& aggregate : aggregates) {
+    Assert(aggregate.function != AggregateFunction::Min && aggregate.function != AggregateFunction::Max,
+           "MIN and MAX cannot be estimated from a sample");
+    Assert(aggregate.column_id || aggregate.function == AggregateFunction::Count,
+           "Only COUNT can be used without a column");
+  }
+}
+
+const std::vector<AggregateColumnDefinition>& ApproximateAggregate::aggregates() const { return _aggregates; }
+
+const std::vector<ColumnID>& ApproximateAggregate::group_by_column_ids() const { return _group_by_column_ids; }
+
+double ApproximateAggregate::confidence() const { return _confidence; }
+
+const std::string ApproximateAggregate::name() const { return "ApproximateAggregate"; }
+
+std::shared_ptr<const Table> ApproximateAggregate::_on_execute() {
+  const auto sample_table = _input_table_left();
+
+  auto output_table = std::make_shared<Table>();
+  for (const auto& column_id : _group_by_column_ids) {
+    Assert(column_id < sample_table->column_count(), "Group by column does not exist");
+    output_table->add_column(sample_table->column_name(column_id), sample_table->column_type(column_id));
+  }
+  for (const auto& aggregate : _aggregates) {
+    if (aggregate.column_id) {
+      Assert(*aggregate.column_id < sample_table->column_count(), "Aggregate column does not exist");
+      Assert(aggregate.function == AggregateFunction::Count ||
+                 sample_table->column_data_type(*aggregate.column_id) != DataType::String,
+             "SUM and AVG are not available for strings");
+    }
+    const auto aggregate_column_name = aggregate_name(aggregate, *sample_table);
+    output_table->add_column(aggregate_column_name, "double");
+    output_table->add_column(aggregate_column_name + " ERROR", "double");
+  }
+
+  // Every chunk of the sample holds the sampled rows of one input chunk, a cluster
+  const auto row_scale = 1.0 / _sample->row_fraction();
+  auto group_ids = std::unordered_map<std::string, size_t>{};
+  auto group_keys = std::vector<std::string>{};
+  // per group, the sums of every aggregate
+  auto group_sums = std::vector<std::vector<ClusterSums>>{};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < sample_table->chunk_count(); ++chunk_id) {
+    const auto chunk_snapshot = sample_table->get_chunk_snapshot(chunk_id);
+    const auto& chunk = *chunk_snapshot;
+    const auto row_count = chunk.size();
+    if (row_count == 0) continue;
+
+    auto row_keys = std::vector<std::string>(row_count);
+    for (const auto& column_id : _group_by_column_ids) {
+      resolve_data_type(sample_table->column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        segment_for_each<ColumnDataType>(
+            *chunk.get_segment(column_id),
+            [&](const ChunkOffset chunk_offset, const SegmentValue<ColumnDataType>& value) {
+              append_key_part<ColumnDataType>(row_keys[chunk_offset], value);
+            });
+      });
+    }
+
+    // Totals of the groups within this chunk
+    auto local_group_ids = std::unordered_map<std::string, size_t>{};
+    auto row_group_ids = std::vector<size_t>(row_count);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      const auto next_group_id = local_group_ids.size();
+      row_group_ids[chunk_offset] = local_group_ids.try_emplace(std::move(row_keys[chunk_offset]), next_group_id)
+                                        .first->second;
+    }
+    auto local_counts = std::vector<double>(local_group_ids.size());
+    for (const auto group_id : row_group_ids) local_counts[group_id] += 1.0;
+
+    auto local_totals = std::vector<std::vector<double>>(_aggregates.size());
+    for (auto aggregate_id = size_t{0}; aggregate_id < _aggregates.size(); ++aggregate_id) {
+      const auto& aggregate = _aggregates[aggregate_id];
+      if (aggregate.function == AggregateFunction::Count) {
+        local_totals[aggregate_id] = local_counts;
+        continue;
+      }
+      local_totals[aggregate_id].resize(local_group_ids.size());
+      resolve_data_type(sample_table->column_data_type(*aggregate.column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+          auto& totals = local_totals[aggregate_id];
+          segment_for_each<ColumnDataType>(*chunk.get_segment(*aggregate.column_id),
+                                           [&](const ChunkOffset chunk_offset, const ColumnDataType value) {
+                                             totals[row_group_ids[chunk_offset]] += static_cast<double>(value);
+                                           });
+        }
+      });
+    }
+
+    for (const auto& [key, local_group_id] : local_group_ids) {
+      const auto [iter, inserted] = group_ids.try_emplace(key, group_keys.size());  // NOLINT
+      if (inserted) {
+        group_keys.push_back(key);
+        group_sums.emplace_back(_aggregates.size());
+      }
+      const auto count = local_counts[local_group_id] * row_scale;
+      for (auto aggregate_id = size_t{0}; aggregate_id < _aggregates.size(); ++aggregate_id) {
+        const auto total = local_totals[aggregate_id][local_group_id] * row_scale;
+        auto& sums = group_sums[iter->second][aggregate_id];
+        sums.totals += total;
+        sums.squared_totals += total * total;
+        sums.counts += count;
+        sums.squared_counts += count * count;
+        sums.products += total * count;
+      }
+    }
+  }
+
+  // Without group by columns, there is exactly one output row, even if the sample is empty
+  if (_group_by_column_ids.empty() && group_keys.empty()) {
+    group_keys.emplace_back();
+    group_sums.emplace_back(_aggregates.size());
+  }
+
+  // Estimates of the totals of the input and of their variances
+  const auto input_chunk_count = static_cast<double>(_sample->input_chunk_count());
+  const auto sampled_chunk_count = static_cast<double>(_sample->sampled_chunk_count());
+  // An input without chunks gives an empty sample, whose totals are known to be zero
+  const auto expansion = sampled_chunk_count > 0.0 ? input_chunk_count / sampled_chunk_count : 0.0;
+  const auto finite_population_correction =
+      _sample->row_fraction() == 1.0 && sampled_chunk_count > 0.0 ? 1.0 - sampled_chunk_count / input_chunk_count
+                                                                   : 1.0;
+  // the variance of an estimated total, given the sums of the cluster totals and of their squares
+  const auto total_variance = [&](const double totals, const double squared_totals) {
+    // Totals are exact if all chunks were sampled in full, or if there are no chunks at all
+    if (sampled_chunk_count == 0.0 || finite_population_correction == 0.0) return 0.0;
+    if (sampled_chunk_count < 2.0) return std::numeric_limits<double>::infinity();
+    const auto variance = std::max(
+        0.0, (squared_totals - totals * totals / sampled_chunk_count) / (sampled_chunk_count - 1.0));
+    return input_chunk_count * input_chunk_count * finite_population_correction * variance / sampled_chunk_count;
+  };
+  const auto z = normal_quantile(_confidence);
+
+  const auto group_count = group_keys.size();
+  auto output_chunk = Chunk{};
+  for (auto group_by_index = size_t{0}; group_by_index < _group_by_column_ids.size(); ++group_by_index) {
+    resolve_data_type(sample_table->column_data_type(_group_by_column_ids[group_by_index]), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      auto values = pmr_vector<ColumnDataType>(group_count);
+      for (auto group_id = size_t{0}; group_id < group_count; ++group_id) {
+        auto position = size_t{0};
+        for (auto skipped_index = size_t{0}; skipped_index < group_by_index; ++skipped_index) {
+          resolve_data_type(sample_table->column_data_type(_group_by_column_ids[skipped_index]), [&](auto skipped) {
+            read_key_part<typename decltype(skipped)::type>(group_keys[group_id], position);
+          });
+        }
+        values[group_id] = read_key_part<ColumnDataType>(group_keys[group_id], position);
+      }
+      output_chunk.add_segment(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+    });
+  }
+
+  for (auto aggregate_id = size_t{0}; aggregate_id < _aggregates.size(); ++aggregate_id) {
+    auto estimates = pmr_vector<double>(group_count);
+    auto errors = pmr_vector<double>(group_count);
+    for (auto group_id = size_t{0}; group_id < group_count; ++group_id) {
+      const auto& sums = group_sums[group_id][aggregate_id];
+      if (_aggregates[aggregate_id].function != AggregateFunction::Avg) {
+        estimates[group_id] = expansion * sums.totals;
+        errors[group_id] = z * std::sqrt(total_variance(sums.totals, sums.squared_totals));
+        continue;
+      }
+
+      // The residuals total - average * count of the chunks sum up to zero
+      const auto average = sums.totals / sums.counts;
+      const auto squared_residuals =
+          sums.squared_totals - 2.0 * average * sums.products + average * average * sums.squared_counts;
+      const auto estimated_count = expansion * sums.counts;
+      estimates[group_id] = average;
+      errors[group_id] = z * std::sqrt(total_variance(0.0, squared_residuals)) / estimated_count;
+    }
+    output_chunk.add_segment(std::make_shared<ValueSegment<double>>(std::move(estimates)));
+    output_chunk.add_segment(std::make_shared<ValueSegment<double>>(std::move(errors)));
+  }
+  output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+}  // namespace opossum
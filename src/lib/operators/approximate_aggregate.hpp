@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "aggregate.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TableSample;
+
+/**
+ * Estimates COUNT, SUM, and AVG per group of the table that a TableSample drew its sample from. MIN and MAX cannot be
+ * estimated from a sample. The output consists of the group by columns followed by two double columns per aggregate:
+ * the estimate, named like "SUM(a)", and the half width of its confidence interval, named like "SUM(a) ERROR". The
+ * true value lies in [estimate - error, estimate + error] with the given confidence.
+ *
+ * The sampled chunks are treated as clusters (Cochran, "Sampling Techniques", ch. 9-11): a total is estimated as the
+ * sum of the totals of the sampled chunks, each scaled by 1 / row_fraction, times input chunks / sampled chunks. Its
+ * variance is estimated from the variance of the scaled totals between the sampled chunks, including those where a
+ * group does not occur. Without row sampling, the finite population correction is applied. AVG is estimated as the
+ * ratio of the estimated SUM and COUNT, its variance by linearization. If only one chunk was sampled, the error is
+ * infinite.
+ *
+ * Groups that do not occur in the sample are missing from the output, so that a sample should hold enough rows per
+ * group.
+ */
+class ApproximateAggregate : public AbstractOperator {
+ public:
+  ApproximateAggregate(const std::shared_ptr<TableSample>& in, const std::vector<AggregateColumnDefinition>& aggregates,
+                       const std::vector<ColumnID>& group_by_column_ids, const double confidence = 0.95);
+
+  const std::vector<AggregateColumnDefinition>& aggregates() const;
+  const std::vector<ColumnID>& group_by_column_ids() const;
+  double confidence() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::shared_ptr<TableSample> _sample;
+  const std::vector<AggregateColumnDefinition> _aggregates;
+  const std::vector<ColumnID> _group_by_column_ids;
+  const double _confidence;
+};
+
+}  // namespace opossum
@@ -0,0 +1,21 @@
+#include "get_table.hpp"
+
+#include <memory>
+#include <string>
+
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+GetTable::GetTable(const std::string& name) : _table_name(name) {}
+
+const std::string& GetTable::table_name() const { return _table_name; }
+
+const std::string GetTable::name() const { return "GetTable"; }
+
+// Operators may run while rows are appended and chunks are merged, so they read a snapshot of the table
+std::shared_ptr<const Table> GetTable::_on_execute() {
+  return StorageManager::get().get_table(_table_name)->snapshot();
+}
+
+}  // namespace opossum
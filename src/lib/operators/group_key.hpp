@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "storage/segment_iterate.hpp"
+
+namespace opossum {
+
+/**
+ * The values of the group by columns of a row are serialized into a single string, which serves as the key of the
+ * hash tables of aggregations. Numbers are stored in their binary representation, strings are prefixed with their
+ * length.
+ */
+template <typename T>
+void append_key_part(std::string& key, const SegmentValue<T>& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto length = static_cast<uint32_t>(value.size());
+    key.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    key.append(value.data(), value.size());
+  } else {
+    // -0.0 and 0.0 are equal, but differ in their binary representation
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    key.append(reinterpret_cast<const char*>(&normalized_value), sizeof(normalized_value));
+  }
+}
+
+// Reads a value that was written by append_key_part and advances position to the next value
+template <typename T>
+T read_key_part(const std::string& key, size_t& position) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto length = uint32_t{0};
+    std::memcpy(&length, key.data() + position, sizeof(length));
+    position += sizeof(length);
+    auto value = key.substr(position, length);
+    position += length;
+    return value;
+  } else {
+    auto value = T{};
+    std::memcpy(&value, key.data() + position, sizeof(value));
+    position += sizeof(value);
+    return value;
+  }
+}
+
+}  // namespace opossum
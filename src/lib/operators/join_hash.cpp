@@ -0,0 +1,325 @@
+#include "join_hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The hash table of a partition of the build side should fit into a typical L2 cache
+constexpr auto L2_CACHE_SIZE = size_t{256 * 1024};
+// With more partitions, the scatter pass would write to more pages than the TLB covers
+constexpr auto MAX_RADIX_BITS = size_t{12};
+// Partitions of the probe side are split into jobs of at most this many values
+constexpr auto PROBE_JOB_SIZE = size_t{64 * 1024};
+// Number of values for which the probe prefetches the hash table slot ahead of time
+constexpr auto PREFETCH_DISTANCE = size_t{16};
+
+template <typename Key>
+uint32_t hash_value(const Key& key) {
+  if constexpr (std::is_same_v<Key, std::string_view>) {
+    return static_cast<uint32_t>(std::hash<std::string_view>{}(key));
+  } else {
+    // -0.0 and 0.0 are equal and need the same hash
+    const auto normalized_key = key == Key{0} ? Key{0} : key;
+    auto bits = uint64_t{0};
+    std::memcpy(&bits, &normalized_key, sizeof(Key));
+    // Fibonacci hashing, the upper bits are well distributed even for consecutive keys
+    return static_cast<uint32_t>((bits * 0x9e3779b97f4a7c15ull) >> 32);
+  }
+}
+
+template <typename Key>
+struct PartitionedElement {
+  uint32_t hash;
+  RowID row_id;
+  Key key;
+};
+
+template <typename Key>
+struct RadixPartitions {
+  std::vector<PartitionedElement<Key>> elements;
+  // partition i spans [offsets[i], offsets[i + 1]) of elements
+  std::vector<size_t> offsets;
+};
+
+// Materializes a column and scatters its values into 2^radix_bits partitions. Within a partition, values keep the
+// order of the table.
+template <typename T>
+RadixPartitions<SegmentValue<T>> radix_partition(const Table& table, const ColumnID column_id,
+                                                 const size_t radix_bits) {
+  using Key = SegmentValue<T>;
+  const auto partition_count = size_t{1} << radix_bits;
+  const auto partition_mask = static_cast<uint32_t>(partition_count - 1);
+  const auto chunk_count = table.chunk_count();
+
+  // Pass 1: materialize every chunk and count its values per partition
+  auto materialized_chunks = std::vector<std::vector<PartitionedElement<Key>>>(chunk_count);
+  auto histograms = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(partition_count));
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_snapshot = table.get_chunk_snapshot(chunk_id);
+      const auto& chunk = *chunk_snapshot;
+      auto& elements = materialized_chunks[chunk_id];
+      auto& histogram = histograms[chunk_id];
+      elements.reserve(chunk.size());
+
+      segment_for_each<T>(*chunk.get_segment(column_id), [&](const ChunkOffset chunk_offset, const Key& key) {
+        const auto hash = hash_value(key);
+        ++histogram[hash & partition_mask];
+        elements.push_back(PartitionedElement<Key>{hash, RowID{chunk_id, chunk_offset}, key});
+      });
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // Turn the histograms into the positions that every chunk writes its values of a partition to
+  auto partitions = RadixPartitions<Key>{};
+  partitions.offsets.resize(partition_count + 1);
+  auto offset = size_t{0};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    partitions.offsets[partition_id] = offset;
+    for (auto& histogram : histograms) {
+      const auto value_count = histogram[partition_id];
+      histogram[partition_id] = offset;
+      offset += value_count;
+    }
+  }
+  partitions.offsets[partition_count] = offset;
+  partitions.elements.resize(offset);
+
+  // Pass 2: scatter the values into their partitions
+  jobs.clear();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& write_offsets = histograms[chunk_id];
+      for (const auto& element : materialized_chunks[chunk_id]) {
+        partitions.elements[write_offsets[element.hash & partition_mask]++] = element;
+      }
+      materialized_chunks[chunk_id] = {};
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  return partitions;
+}
+
+// Open-addressing hash table with linear probing over one partition of the build side. Every distinct value occupies
+// one slot. Elements with the same value are chained, so that duplicates do not lengthen the probe sequences.
+template <typename Key>
+class PartitionHashTable {
+ public:
+  PartitionHashTable(const PartitionedElement<Key>* elements, const size_t element_count, const size_t radix_bits)
+      : _elements(elements), _radix_bits(radix_bits), _next(element_count) {
+    auto capacity = size_t{8};
+    while (capacity < element_count * 2) capacity *= 2;
+    _slots.resize(capacity, Slot{0, EMPTY, Key{}});
+    _mask = capacity - 1;
+
+    // Inserting in reverse order keeps the chains in the order of the table
+    for (auto element_index = element_count; element_index-- > 0;) {
+      const auto& element = elements[element_index];
+      for (auto slot_index = _slot_index(element.hash);; slot_index = (slot_index + 1) & _mask) {
+        auto& slot = _slots[slot_index];
+        if (slot.first == EMPTY) {
+          slot = Slot{element.hash, static_cast<uint32_t>(element_index), element.key};
+          _next[element_index] = EMPTY;
+          break;
+        }
+        if (slot.hash == element.hash && slot.key == element.key) {
+          _next[element_index] = slot.first;
+          slot.first = static_cast<uint32_t>(element_index);
+          break;
+        }
+      }
+    }
+  }
+
+  void prefetch(const uint32_t hash) const { __builtin_prefetch(&_slots[_slot_index(hash)]); }
+
+  // calls func(build_element) for every element of the build side with the same value as probe_element
+  template <typename Functor>
+  void for_each_match(const PartitionedElement<Key>& probe_element, const Functor& func) const {
+    for (auto slot_index = _slot_index(probe_element.hash);; slot_index = (slot_index + 1) & _mask) {
+      const auto& slot = _slots[slot_index];
+      if (slot.first == EMPTY) return;
+      if (slot.hash == probe_element.hash && slot.key == probe_element.key) {
+        for (auto element_index = slot.first; element_index != EMPTY; element_index = _next[element_index]) {
+          func(_elements[element_index]);
+        }
+        return;
+      }
+    }
+  }
+
+ protected:
+  struct Slot {
+    uint32_t hash;
+    uint32_t first;
+    Key key;
+  };
+
+  static constexpr auto EMPTY = std::numeric_limits<uint32_t>::max();
+
+  // The lower radix_bits are equal for all values of a partition
+  size_t _slot_index(const uint32_t hash) const { return (hash >> _radix_bits) & _mask; }
+
+  const PartitionedElement<Key>* const _elements;
+  const size_t _radix_bits;
+  size_t _mask;
+  std::vector<Slot> _slots;
+  std::vector<uint32_t> _next;
+};
+
+// Chooses the number of partitions so that the elements and the hash table of a build partition fit into L2
+template <typename Key>
+size_t radix_bits_for(const size_t build_row_count) {
+  const auto build_size = build_row_count * (sizeof(PartitionedElement<Key>) + 2 * (sizeof(Key) + 8));
+  auto radix_bits = size_t{0};
+  while (radix_bits < MAX_RADIX_BITS && (build_size >> radix_bits) > L2_CACHE_SIZE) ++radix_bits;
+  return radix_bits;
+}
+
+// returns the matching rows of the build and the probe table
+template <typename T>
+std::pair<std::shared_ptr<PosList>, std::shared_ptr<PosList>> hash_join(const Table& build_table,
+                                                                        const ColumnID build_column_id,
+                                                                        const Table& probe_table,
+                                                                        const ColumnID probe_column_id) {
+  using Key = SegmentValue<T>;
+  const auto radix_bits = radix_bits_for<Key>(build_table.row_count());
+  const auto partition_count = size_t{1} << radix_bits;
+
+  auto build_partitions = RadixPartitions<Key>{};
+  auto probe_partitions = RadixPartitions<Key>{};
+  CurrentScheduler::schedule_and_wait_for_tasks(
+      {std::make_shared<JobTask>(
+           [&]() { build_partitions = radix_partition<T>(build_table, build_column_id, radix_bits); }),
+       std::make_shared<JobTask>(
+           [&]() { probe_partitions = radix_partition<T>(probe_table, probe_column_id, radix_bits); })});
+
+  const auto partition_size = [](const RadixPartitions<Key>& partitions, const size_t partition_id) {
+    return partitions.offsets[partition_id + 1] - partitions.offsets[partition_id];
+  };
+
+  // Build one hash table per partition. Partitions without a partner on the probe side are skipped.
+  auto hash_tables = std::vector<std::unique_ptr<PartitionHashTable<Key>>>(partition_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    if (partition_size(build_partitions, partition_id) == 0 || partition_size(probe_partitions, partition_id) == 0) {
+      continue;
+    }
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      hash_tables[partition_id] = std::make_unique<PartitionHashTable<Key>>(
+          build_partitions.elements.data() + build_partitions.offsets[partition_id],
+          partition_size(build_partitions, partition_id), radix_bits);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // Probe in jobs of at most PROBE_JOB_SIZE values. Every job writes its own matches, which are concatenated in job
+  // order afterwards.
+  auto job_matches = std::vector<std::pair<PosList, PosList>>{};
+  auto job_ranges = std::vector<std::tuple<size_t, size_t, size_t>>{};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    if (!hash_tables[partition_id]) continue;
+    const auto partition_end = probe_partitions.offsets[partition_id + 1];
+    for (auto begin = probe_partitions.offsets[partition_id]; begin < partition_end; begin += PROBE_JOB_SIZE) {
+      job_ranges.emplace_back(partition_id, begin, std::min(begin + PROBE_JOB_SIZE, partition_end));
+    }
+  }
+  job_matches.resize(job_ranges.size());
+
+  jobs.clear();
+  for (auto job_id = size_t{0}; job_id < job_ranges.size(); ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      const auto [partition_id, begin, end] = job_ranges[job_id];  // NOLINT
+      const auto& hash_table = *hash_tables[partition_id];
+      const auto& elements = probe_partitions.elements;
+      auto& [build_matches, probe_matches] = job_matches[job_id];  // NOLINT
+
+      for (auto element_index = begin; element_index < end; ++element_index) {
+        if (element_index + PREFETCH_DISTANCE < end) {
+          hash_table.prefetch(elements[element_index + PREFETCH_DISTANCE].hash);
+        }
+
+        const auto& probe_element = elements[element_index];
+        hash_table.for_each_match(probe_element, [&](const PartitionedElement<Key>& build_element) {
+          build_matches.push_back(build_element.row_id);
+          probe_matches.push_back(probe_element.row_id);
+        });
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto match_count = size_t{0};
+  for (const auto& matches : job_matches) {
+    match_count += matches.first.size();
+  }
+
+  auto build_pos_list = std::make_shared<PosList>();
+  auto probe_pos_list = std::make_shared<PosList>();
+  build_pos_list->reserve(match_count);
+  probe_pos_list->reserve(match_count);
+  for (const auto& matches : job_matches) {
+    build_pos_list->insert(build_pos_list->end(), matches.first.begin(), matches.first.end());
+    probe_pos_list->insert(probe_pos_list->end(), matches.second.begin(), matches.second.end());
+  }
+
+  return {build_pos_list, probe_pos_list};
+}
+
+}  // namespace
+
+JoinHash::JoinHash(const std::shared_ptr<AbstractOperator> left, const std::shared_ptr<AbstractOperator> right,
+                   const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractJoinOperator(left, right, column_ids, scan_type) {}
+
+const std::string JoinHash::name() const { return "JoinHash"; }
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  Assert(_scan_type == ScanType::OpEquals, "JoinHash only supports equi-joins");
+
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  const auto data_type = left_table->column_data_type(_column_ids.first);
+  Assert(data_type == right_table->column_data_type(_column_ids.second),
+         "Join columns need to have the same data type");
+
+  // The smaller input is used as build side
+  const auto build_left = left_table->row_count() <= right_table->row_count();
+  auto left_pos_list = std::shared_ptr<PosList>{};
+  auto right_pos_list = std::shared_ptr<PosList>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if (build_left) {
+      std::tie(left_pos_list, right_pos_list) =
+          hash_join<ColumnDataType>(*left_table, _column_ids.first, *right_table, _column_ids.second);
+    } else {
+      std::tie(right_pos_list, left_pos_list) =
+          hash_join<ColumnDataType>(*right_table, _column_ids.second, *left_table, _column_ids.first);
+    }
+  });
+
+  return _build_output(left_pos_list, right_pos_list);
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Inner equi-join that uses a radix-partitioned hash join:
+ *
+ * 1. Both join columns are materialized chunk by chunk and scattered into 2^radix_bits partitions by the lower bits
+ *    of the hash of their values (one parallel pass for the histograms, one for the scatter). The number of
+ *    partitions is chosen so that the hash table of a partition of the build side fits into the L2 cache.
+ * 2. For every partition, an open-addressing hash table is built over the smaller input. Equal values share a slot
+ *    and are chained, so that a heavily skewed build side does not lead to long probe sequences.
+ * 3. The other input probes the hash table of its partition, prefetching the slots of upcoming values. Large probe
+ *    partitions are split into several jobs, so that a skewed probe side is still processed in parallel.
+ *
+ * The matching rows are emitted as two position lists, one for each input.
+ *
+ * Both join columns need to have the same data type. All segment types are supported, including ReferenceSegments.
+ */
+class JoinHash : public AbstractJoinOperator {
+ public:
+  JoinHash(const std::shared_ptr<AbstractOperator> left, const std::shared_ptr<AbstractOperator> right,
+           const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type = ScanType::OpEquals);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,284 @@
+#include "join_sort_merge.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_queue_scheduler.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Number of values that every sorted chunk contributes to the samples from which the split values are chosen
+constexpr auto SAMPLES_PER_RUN = size_t{64};
+
+template <typename Key>
+struct MaterializedValue {
+  Key key;
+  RowID row_id;
+};
+
+// a sequence of materialized values, sorted by key
+template <typename Key>
+using SortedRun = std::vector<MaterializedValue<Key>>;
+
+template <typename Key>
+bool key_less(const MaterializedValue<Key>& left, const MaterializedValue<Key>& right) {
+  return left.key < right.key;
+}
+
+// Materializes every chunk of a column and sorts it, unless the chunk is already sorted by the column
+template <typename T>
+std::vector<SortedRun<SegmentValue<T>>> materialize_sorted_runs(const Table& table, const ColumnID column_id) {
+  using Key = SegmentValue<T>;
+  auto runs = std::vector<SortedRun<Key>>(table.chunk_count());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_snapshot = table.get_chunk_snapshot(chunk_id);
+      const auto& chunk = *chunk_snapshot;
+      auto& run = runs[chunk_id];
+      run.reserve(chunk.size());
+      segment_for_each<T>(*chunk.get_segment(column_id), [&](const ChunkOffset chunk_offset, const Key& key) {
+        run.push_back(MaterializedValue<Key>{key, RowID{chunk_id, chunk_offset}});
+      });
+
+      if (chunk.ordered_by() == column_id) {
+        DebugAssert(std::is_sorted(run.begin(), run.end(), key_less<Key>), "Chunk is flagged as sorted but is not");
+      } else {
+        std::sort(run.begin(), run.end(), key_less<Key>);
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  return runs;
+}
+
+// Chooses up to partition_count - 1 distinct split values from evenly spaced samples of all runs of both inputs.
+// Partition i covers the values in [split_values[i - 1], split_values[i]).
+template <typename Key>
+std::vector<Key> choose_split_values(const std::vector<SortedRun<Key>>& left_runs,
+                                     const std::vector<SortedRun<Key>>& right_runs, const size_t partition_count) {
+  if (partition_count <= 1) return {};
+
+  auto samples = std::vector<Key>{};
+  for (const auto* runs : {&left_runs, &right_runs}) {
+    for (const auto& run : *runs) {
+      const auto sample_count = std::min(run.size(), SAMPLES_PER_RUN);
+      for (auto sample_index = size_t{0}; sample_index < sample_count; ++sample_index) {
+        samples.push_back(run[sample_index * run.size() / sample_count].key);
+      }
+    }
+  }
+  if (samples.empty()) return {};
+  std::sort(samples.begin(), samples.end());
+
+  auto split_values = std::vector<Key>{};
+  for (auto partition_id = size_t{1}; partition_id < partition_count; ++partition_id) {
+    split_values.push_back(samples[partition_id * samples.size() / partition_count]);
+  }
+  split_values.erase(std::unique(split_values.begin(), split_values.end()), split_values.end());
+  return split_values;
+}
+
+// Collects the slices of all runs that fall into a partition and merges them into a single sorted run
+template <typename Key>
+std::vector<SortedRun<Key>> range_partition(const std::vector<SortedRun<Key>>& runs,
+                                            const std::vector<Key>& split_values) {
+  const auto partition_count = split_values.size() + 1;
+  auto partitions = std::vector<SortedRun<Key>>(partition_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      const auto value_less = [](const MaterializedValue<Key>& value, const Key& key) { return value.key < key; };
+
+      auto& partition = partitions[partition_id];
+      auto run_bounds = std::vector<size_t>{0};
+      for (const auto& run : runs) {
+        const auto begin = partition_id == 0 ? run.begin()
+                                             : std::lower_bound(run.begin(), run.end(),
+                                                                split_values[partition_id - 1], value_less);
+        const auto end = partition_id == partition_count - 1
+                             ? run.end()
+                             : std::lower_bound(begin, run.end(), split_values[partition_id], value_less);
+        if (begin == end) continue;
+        partition.insert(partition.end(), begin, end);
+        run_bounds.push_back(partition.size());
+      }
+
+      // Merge neighboring runs until a single one is left
+      while (run_bounds.size() > 2) {
+        auto merged_run_bounds = std::vector<size_t>{0};
+        for (auto run_index = size_t{0}; run_index + 1 < run_bounds.size(); run_index += 2) {
+          if (run_index + 2 < run_bounds.size()) {
+            std::inplace_merge(partition.begin() + run_bounds[run_index], partition.begin() + run_bounds[run_index + 1],
+                               partition.begin() + run_bounds[run_index + 2], key_less<Key>);
+            merged_run_bounds.push_back(run_bounds[run_index + 2]);
+          } else {
+            merged_run_bounds.push_back(run_bounds[run_index + 1]);
+          }
+        }
+        run_bounds = std::move(merged_run_bounds);
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  return partitions;
+}
+
+// returns the matching rows of the left and the right input
+template <typename T>
+std::pair<std::shared_ptr<PosList>, std::shared_ptr<PosList>> sort_merge_join(const Table& left_table,
+                                                                               const ColumnID left_column_id,
+                                                                               const Table& right_table,
+                                                                               const ColumnID right_column_id,
+                                                                               const ScanType scan_type) {
+  using Key = SegmentValue<T>;
+
+  auto left_runs = std::vector<SortedRun<Key>>{};
+  auto right_runs = std::vector<SortedRun<Key>>{};
+  CurrentScheduler::schedule_and_wait_for_tasks(
+      {std::make_shared<JobTask>([&]() { left_runs = materialize_sorted_runs<T>(left_table, left_column_id); }),
+       std::make_shared<JobTask>([&]() { right_runs = materialize_sorted_runs<T>(right_table, right_column_id); })});
+
+  const auto scheduler = CurrentScheduler::get();
+  const auto worker_count = scheduler ? scheduler->worker_count() : 1;
+  const auto split_values = choose_split_values(left_runs, right_runs, worker_count);
+
+  auto left_partitions = std::vector<SortedRun<Key>>{};
+  auto right_partitions = std::vector<SortedRun<Key>>{};
+  CurrentScheduler::schedule_and_wait_for_tasks(
+      {std::make_shared<JobTask>([&]() { left_partitions = range_partition(left_runs, split_values); }),
+       std::make_shared<JobTask>([&]() { right_partitions = range_partition(right_runs, split_values); })});
+  left_runs.clear();
+  right_runs.clear();
+
+  const auto partition_count = left_partitions.size();
+  auto partition_matches = std::vector<std::pair<PosList, PosList>>(partition_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      const auto& left_partition = left_partitions[partition_id];
+      const auto& right_partition = right_partitions[partition_id];
+      auto& [left_matches, right_matches] = partition_matches[partition_id];  // NOLINT
+
+      const auto emit_range = [&](const RowID left_row_id, const size_t begin, const size_t end) {
+        for (auto index = begin; index < end; ++index) {
+          left_matches.push_back(left_row_id);
+          right_matches.push_back(right_partition[index].row_id);
+        }
+      };
+      // All values of the partitions in [begin, end) are smaller (or greater) than those of this partition
+      const auto emit_partitions = [&](const RowID left_row_id, const size_t begin, const size_t end) {
+        for (auto other_partition_id = begin; other_partition_id < end; ++other_partition_id) {
+          for (const auto& right_value : right_partitions[other_partition_id]) {
+            left_matches.push_back(left_row_id);
+            right_matches.push_back(right_value.row_id);
+          }
+        }
+      };
+
+      // Both partitions are sorted, so the range of equal right values only moves forward
+      auto equal_begin = size_t{0};
+      auto equal_end = size_t{0};
+      for (const auto& left_value : left_partition) {
+        while (equal_begin < right_partition.size() && right_partition[equal_begin].key < left_value.key) {
+          ++equal_begin;
+        }
+        equal_end = std::max(equal_end, equal_begin);
+        while (equal_end < right_partition.size() && !(left_value.key < right_partition[equal_end].key)) {
+          ++equal_end;
+        }
+
+        const auto row_id = left_value.row_id;
+        switch (scan_type) {
+          case ScanType::OpEquals:
+            emit_range(row_id, equal_begin, equal_end);
+            break;
+          case ScanType::OpNotEquals:
+            emit_partitions(row_id, 0, partition_id);
+            emit_range(row_id, 0, equal_begin);
+            emit_range(row_id, equal_end, right_partition.size());
+            emit_partitions(row_id, partition_id + 1, partition_count);
+            break;
+          case ScanType::OpLessThan:
+            emit_range(row_id, equal_end, right_partition.size());
+            emit_partitions(row_id, partition_id + 1, partition_count);
+            break;
+          case ScanType::OpLessThanEquals:
+            emit_range(row_id, equal_begin, right_partition.size());
+            emit_partitions(row_id, partition_id + 1, partition_count);
+            break;
+          case ScanType::OpGreaterThan:
+            emit_partitions(row_id, 0, partition_id);
+            emit_range(row_id, 0, equal_begin);
+            break;
+          case ScanType::OpGreaterThanEquals:
+            emit_partitions(row_id, 0, partition_id);
+            emit_range(row_id, 0, equal_end);
+            break;
+        }
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto match_count = size_t{0};
+  for (const auto& matches : partition_matches) {
+    match_count += matches.first.size();
+  }
+
+  auto left_pos_list = std::make_shared<PosList>();
+  auto right_pos_list = std::make_shared<PosList>();
+  left_pos_list->reserve(match_count);
+  right_pos_list->reserve(match_count);
+  for (const auto& matches : partition_matches) {
+    left_pos_list->insert(left_pos_list->end(), matches.first.begin(), matches.first.end());
+    right_pos_list->insert(right_pos_list->end(), matches.second.begin(), matches.second.end());
+  }
+
+  return {left_pos_list, right_pos_list};
+}
+
+}  // namespace
+
+JoinSortMerge::JoinSortMerge(const std::shared_ptr<AbstractOperator> left,
+                             const std::shared_ptr<AbstractOperator> right,
+                             const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractJoinOperator(left, right, column_ids, scan_type) {}
+
+const std::string JoinSortMerge::name() const { return "JoinSortMerge"; }
+
+std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  const auto data_type = left_table->column_data_type(_column_ids.first);
+  Assert(data_type == right_table->column_data_type(_column_ids.second),
+         "Join columns need to have the same data type");
+
+  auto left_pos_list = std::shared_ptr<PosList>{};
+  auto right_pos_list = std::shared_ptr<PosList>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    std::tie(left_pos_list, right_pos_list) = sort_merge_join<ColumnDataType>(
+        *left_table, _column_ids.first, *right_table, _column_ids.second, _scan_type);
+  });
+
+  return _build_output(left_pos_list, right_pos_list);
+}
+
+}  // namespace opossum
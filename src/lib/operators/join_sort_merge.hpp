@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Inner join that supports all ScanTypes as join predicate, e.g., left.a < right.b:
+ *
+ * 1. Both join columns are materialized chunk by chunk, and every chunk is sorted in parallel. Chunks that are
+ *    flagged as sorted by the join column (see Chunk::ordered_by) are not sorted again.
+ * 2. Split values that are sampled from the sorted chunks divide the value range into one partition per worker.
+ *    Both inputs are partitioned with the same split values, and the sorted chunk slices of every partition are
+ *    merged in parallel.
+ * 3. Every partition of the left input is merged with the partition of the right input that covers the same value
+ *    range. For inequality predicates, the partitions below or above it match entirely.
+ *
+ * The matching rows are emitted as two position lists, one for each input.
+ *
+ * Both join columns need to have the same data type. All segment types are supported, including ReferenceSegments.
+ */
+class JoinSortMerge : public AbstractJoinOperator {
+ public:
+  JoinSortMerge(const std::shared_ptr<AbstractOperator> left, const std::shared_ptr<AbstractOperator> right,
+                const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#include "limit.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "storage/table.hpp"
+
+namespace opossum {
+
+Limit::Limit(const std::shared_ptr<AbstractOperator> in, const size_t row_count)
+    : AbstractOperator(in), _row_count(row_count) {}
+
+size_t Limit::row_count() const { return _row_count; }
+
+const std::string Limit::name() const { return "Limit"; }
+
+std::shared_ptr<const Table> Limit::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->reserve(std::min(_row_count, static_cast<size_t>(input_table->row_count())));
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count() && pos_list->size() < _row_count; ++chunk_id) {
+    const auto chunk_row_count =
+        std::min(static_cast<size_t>(input_table->get_chunk_snapshot(chunk_id)->size()), _row_count - pos_list->size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_row_count; ++chunk_offset) {
+      pos_list->push_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  auto output_table = std::make_shared<Table>();
+  _add_output_columns(*input_table, *output_table);
+  auto output_chunk = Chunk{};
+  _add_reference_segments(input_table, pos_list, output_chunk);
+  output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Emits the first row_count rows of the input (LIMIT) as a single chunk of ReferenceSegments. The chunks of the input
+ * are only visited until enough rows are collected.
+ */
+class Limit : public AbstractOperator {
+ public:
+  Limit(const std::shared_ptr<AbstractOperator> in, const size_t row_count);
+
+  size_t row_count() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const size_t _row_count;
+};
+
+}  // namespace opossum
@@ -0,0 +1,102 @@
+#include "materialize.hpp"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns the DictionarySegment that all positions of a ReferenceSegment point into, or nullptr if there is none
+template <typename T>
+std::shared_ptr<const DictionarySegment<T>> single_referenced_dictionary_segment(
+    const ReferenceSegment& reference_segment) {
+  const auto& pos_list = *reference_segment.pos_list();
+  if (pos_list.empty()) return nullptr;
+
+  const auto chunk_id = pos_list.front().chunk_id;
+  for (const auto& row_id : pos_list) {
+    if (row_id.chunk_id != chunk_id) return nullptr;
+  }
+  const auto referenced_chunk_snapshot = reference_segment.referenced_table()->get_chunk_snapshot(chunk_id);
+  const auto& referenced_chunk = *referenced_chunk_snapshot;
+  return std::dynamic_pointer_cast<const DictionarySegment<T>>(
+      referenced_chunk.get_segment(reference_segment.referenced_column_id()));
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> materialize_segment(const std::shared_ptr<BaseSegment>& segment) {
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+  if (!reference_segment) return segment;
+
+  const auto& pos_list = *reference_segment->pos_list();
+  const auto dictionary_segment = single_referenced_dictionary_segment<T>(*reference_segment);
+  if (dictionary_segment && (std::is_same_v<T, std::string> ||
+                             dictionary_segment->attribute_vector()->width() < sizeof(T))) {
+    auto output_segment = std::shared_ptr<BaseSegment>{};
+    resolve_attribute_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+      using AttributeVector = std::decay_t<decltype(attribute_vector)>;
+      using ValueIDType = typename std::decay_t<decltype(attribute_vector.values())>::value_type;
+
+      const auto& input_value_ids = attribute_vector.values();
+      auto value_ids = pmr_vector<ValueIDType>(pos_list.size());
+      auto* out = value_ids.data();
+      for_each_prefetched_position(
+          pos_list, 0, pos_list.size(),
+          [&](const ChunkOffset chunk_offset) { __builtin_prefetch(&input_value_ids[chunk_offset]); },
+          [&](const ChunkOffset chunk_offset) { *out++ = input_value_ids[chunk_offset]; });
+
+      output_segment = std::make_shared<DictionarySegment<T>>(
+          dictionary_segment->dictionary(), std::make_shared<AttributeVector>(std::move(value_ids)));
+    });
+    return output_segment;
+  }
+
+  auto values = pmr_vector<T>(pos_list.size());
+  segment_materialize<T>(*reference_segment, values.data());
+  return std::make_shared<ValueSegment<T>>(std::move(values));
+}
+
+}  // namespace
+
+Materialize::Materialize(const std::shared_ptr<AbstractOperator> in) : AbstractOperator(in) {}
+
+const std::string Materialize::name() const { return "Materialize"; }
+
+std::shared_ptr<const Table> Materialize::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  auto output_chunks = std::vector<Chunk>(input_table->chunk_count());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto input_chunk_snapshot = input_table->get_chunk_snapshot(chunk_id);
+      const auto& input_chunk = *input_chunk_snapshot;
+      auto& output_chunk = output_chunks[chunk_id];
+      for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+        resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          output_chunk.add_segment(materialize_segment<ColumnDataType>(input_chunk.get_segment(column_id)));
+        });
+      }
+      if (const auto ordered_by = input_chunk.ordered_by()) output_chunk.set_ordered_by(*ordered_by);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto output_table = std::make_shared<Table>();
+  _add_output_columns(*input_table, *output_table);
+  for (auto& output_chunk : output_chunks) output_table->emplace_chunk(std::move(output_chunk));
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Turns the ReferenceSegments of its input into data segments (late materialization), e.g., before the result of a
+ * query is handed out. Every chunk is materialized by its own job.
+ *
+ * Values are gathered in bulk with segment_materialize, which resolves every referenced segment once per chunk and
+ * prefetches the upcoming positions, instead of calling operator[] for every row. The output is a ValueSegment,
+ * unless all positions of a segment point into the same DictionarySegment and its value ids are narrower than the
+ * values (always for strings). Then, only the value ids are gathered, and the output DictionarySegment shares the
+ * dictionary of the referenced segment. Data segments of the input are passed on as they are.
+ */
+class Materialize : public AbstractOperator {
+ public:
+  explicit Materialize(const std::shared_ptr<AbstractOperator> in);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,252 @@
+#include "pipeline_executor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "aggregate.hpp"
+#include "expression/arithmetic_expression.hpp"
+#include "expression/case_expression.hpp"
+#include "expression/column_expression.hpp"
+#include "expression/comparison_expression.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "projection.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_queue_scheduler.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "table_scan.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Replaces every ColumnExpression in an expression with the expression that computes the column
+std::shared_ptr<AbstractExpression> substitute_columns(
+    const std::shared_ptr<AbstractExpression>& expression,
+    const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions) {
+  const auto substitute = [&](const std::shared_ptr<AbstractExpression>& argument) {
+    return substitute_columns(argument, column_expressions);
+  };
+
+  switch (expression->type()) {
+    case ExpressionType::Column: {
+      const auto column_id = static_cast<const ColumnExpression&>(*expression).column_id();
+      Assert(column_id < column_expressions.size(), "Column does not exist");
+      return column_expressions[column_id];
+    }
+    case ExpressionType::Value:
+      return expression;
+    case ExpressionType::Arithmetic: {
+      const auto& arithmetic = static_cast<const ArithmeticExpression&>(*expression);
+      return std::make_shared<ArithmeticExpression>(arithmetic.arithmetic_operator(), substitute(arithmetic.left()),
+                                                    substitute(arithmetic.right()));
+    }
+    case ExpressionType::Comparison: {
+      const auto& comparison = static_cast<const ComparisonExpression&>(*expression);
+      return std::make_shared<ComparisonExpression>(comparison.scan_type(), substitute(comparison.left()),
+                                                    substitute(comparison.right()));
+    }
+    case ExpressionType::Logical: {
+      const auto& logical = static_cast<const LogicalExpression&>(*expression);
+      return std::make_shared<LogicalExpression>(logical.logical_operator(), substitute(logical.left()),
+                                                 substitute(logical.right()));
+    }
+    case ExpressionType::Case: {
+      const auto& case_expression = static_cast<const CaseExpression&>(*expression);
+      return std::make_shared<CaseExpression>(substitute(case_expression.when()), substitute(case_expression.then()),
+                                              substitute(case_expression.otherwise()));
+    }
+  }
+  Fail("Unknown expression type");
+  return nullptr;
+}
+
+// Calls process_morsel(morsel_index) for every morsel. One job per worker pulls the next morsel from a shared counter.
+void for_each_morsel(const size_t morsel_count, const std::function<void(const size_t)>& process_morsel) {
+  const auto scheduler = CurrentScheduler::get();
+  const auto worker_count = std::min(size_t{scheduler ? scheduler->worker_count() : 1}, morsel_count);
+
+  auto next_morsel_index = std::atomic<size_t>{0};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      for (auto morsel_index = next_morsel_index++; morsel_index < morsel_count; morsel_index = next_morsel_index++) {
+        process_morsel(morsel_index);
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+}
+
+}  // namespace
+
+PipelineExecutor::PipelineExecutor(const std::shared_ptr<AbstractOperator>& root) : _root(root) {}
+
+std::shared_ptr<const Table> PipelineExecutor::execute() { return _execute(_root); }
+
+std::shared_ptr<const Table> PipelineExecutor::_execute(const std::shared_ptr<AbstractOperator>& op) {
+  // E.g., a TableWrapper that was executed when the plan was built
+  if (op->get_output()) return op->get_output();
+
+  const auto start = std::chrono::steady_clock::now();
+  if (std::dynamic_pointer_cast<TableScan>(op) || std::dynamic_pointer_cast<Projection>(op)) {
+    op->_output = _collect(_compile(op));
+  } else if (const auto aggregate = std::dynamic_pointer_cast<Aggregate>(op)) {
+    const auto pipeline = _compile(aggregate->input_left());
+    const auto morsels = _split_into_morsels(*pipeline.source);
+    op->_output = aggregate->_aggregate(*pipeline.output_definition, morsels.size(), [&](const size_t morsel_index) {
+      return std::shared_ptr<const Chunk>{_process_morsel(pipeline, morsels[morsel_index], true)};
+    });
+  } else {
+    // A pipeline breaker (or an operator that cannot be fused) consumes the complete outputs of its inputs
+    if (op->input_left()) _execute(op->input_left());
+    if (op->input_right()) _execute(op->input_right());
+    op->execute();
+    return op->get_output();
+  }
+  op->_performance_data.walltime = std::chrono::steady_clock::now() - start;
+
+  return op->get_output();
+}
+
+PipelineExecutor::Pipeline PipelineExecutor::_compile(const std::shared_ptr<AbstractOperator>& op) {
+  if (!op->get_output()) {
+    if (const auto table_scan = std::dynamic_pointer_cast<TableScan>(op)) {
+      auto pipeline = _compile(table_scan->input_left());
+      const auto column_id = table_scan->column_id();
+      Assert(column_id < pipeline.output_expressions.size(), "Scan column does not exist");
+
+      // Like the TableScan, compare with the search value converted into the type of the column
+      auto search_value = AllTypeVariant{};
+      resolve_data_type(pipeline.output_definition->column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        search_value = type_cast<ColumnDataType>(table_scan->search_value());
+      });
+      pipeline.predicates.emplace_back(
+          std::make_shared<ComparisonExpression>(table_scan->scan_type(), pipeline.output_expressions[column_id],
+                                                 std::make_shared<ValueExpression>(search_value)));
+      return pipeline;
+    }
+
+    if (const auto projection = std::dynamic_pointer_cast<Projection>(op)) {
+      auto pipeline = _compile(projection->input_left());
+      auto output_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+      auto output_definition = std::make_shared<Table>();
+      for (const auto& expression : projection->expressions()) {
+        output_expressions.emplace_back(substitute_columns(expression, pipeline.output_expressions));
+        output_definition->add_column(expression->description(*pipeline.output_definition),
+                                      data_type_to_string(expression->data_type(*pipeline.output_definition)));
+      }
+      pipeline.output_expressions = std::move(output_expressions);
+      pipeline.output_definition = std::move(output_definition);
+      return pipeline;
+    }
+  }
+
+  auto pipeline = Pipeline{};
+  pipeline.source = _execute(op);
+  pipeline.output_definition = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < pipeline.source->column_count(); ++column_id) {
+    pipeline.output_expressions.emplace_back(std::make_shared<ColumnExpression>(column_id));
+    pipeline.output_definition->add_column(pipeline.source->column_name(column_id),
+                                           pipeline.source->column_type(column_id));
+  }
+  return pipeline;
+}
+
+std::vector<PipelineExecutor::Morsel> PipelineExecutor::_split_into_morsels(const Table& table) {
+  auto morsels = std::vector<Morsel>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto row_count = table.get_chunk_snapshot(chunk_id)->size();
+    for (auto begin = ChunkOffset{0}; begin < row_count; begin += MORSEL_SIZE) {
+      morsels.push_back(Morsel{chunk_id, begin, std::min(static_cast<ChunkOffset>(begin + MORSEL_SIZE), row_count)});
+    }
+  }
+  return morsels;
+}
+
+std::shared_ptr<Chunk> PipelineExecutor::_process_morsel(const Pipeline& pipeline, const Morsel& morsel,
+                                                         const bool forward_segments) {
+  const auto chunk_snapshot = pipeline.source->get_chunk_snapshot(morsel.chunk_id);
+  const auto& chunk = *chunk_snapshot;
+  const auto evaluator = ExpressionEvaluator{pipeline.source, morsel.chunk_id};
+
+  auto rows = ExpressionEvaluator::Selection(morsel.end - morsel.begin);
+  std::iota(rows.begin(), rows.end(), morsel.begin);
+  for (const auto& predicate : pipeline.predicates) {
+    if (rows.empty()) break;
+    rows = evaluator.evaluate_to_selection(*predicate, rows);
+  }
+  const auto is_whole_chunk = rows.size() == chunk.size();
+
+  // The positions of the remaining rows, by the position list of the source segment (nullptr for data segments).
+  // Columns that reference the same positions share them.
+  auto pos_lists = std::map<const PosList*, std::shared_ptr<PosList>>{};
+
+  auto batch = std::make_shared<Chunk>();
+  for (const auto& expression : pipeline.output_expressions) {
+    if (expression->type() != ExpressionType::Column) {
+      batch->add_segment(evaluator.evaluate_to_segment(*expression, rows));
+      continue;
+    }
+
+    const auto column_id = static_cast<const ColumnExpression&>(*expression).column_id();
+    const auto segment = chunk.get_segment(column_id);
+    if (forward_segments && is_whole_chunk) {
+      batch->add_segment(segment);
+      continue;
+    }
+
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+    const auto* input_pos_list = reference_segment ? reference_segment->pos_list().get() : nullptr;
+    auto& positions = pos_lists[input_pos_list];
+    if (!positions) {
+      positions = std::make_shared<PosList>();
+      positions->reserve(rows.size());
+      for (const auto row : rows) {
+        positions->push_back(input_pos_list ? (*input_pos_list)[row] : RowID{morsel.chunk_id, row});
+      }
+    }
+
+    if (reference_segment) {
+      batch->add_segment(std::make_shared<ReferenceSegment>(reference_segment->referenced_table(),
+                                                            reference_segment->referenced_column_id(), positions));
+    } else {
+      batch->add_segment(std::make_shared<ReferenceSegment>(pipeline.source, column_id, positions));
+    }
+  }
+
+  return batch;
+}
+
+std::shared_ptr<const Table> PipelineExecutor::_collect(const Pipeline& pipeline) {
+  const auto morsels = _split_into_morsels(*pipeline.source);
+  auto batches = std::vector<std::shared_ptr<Chunk>>(morsels.size());
+  for_each_morsel(morsels.size(), [&](const size_t morsel_index) {
+    batches[morsel_index] = _process_morsel(pipeline, morsels[morsel_index], false);
+  });
+
+  auto output_table = std::make_shared<Table>();
+  const auto& output_definition = *pipeline.output_definition;
+  for (auto column_id = ColumnID{0}; column_id < output_definition.column_count(); ++column_id) {
+    output_table->add_column(output_definition.column_name(column_id), output_definition.column_type(column_id));
+  }
+  for (const auto& batch : batches) {
+    if (batch->size() > 0) output_table->emplace_chunk(std::move(*batch));
+  }
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/expression_evaluator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Chunk;
+class Table;
+
+/**
+ * Executes a plan of operators pipeline by pipeline instead of operator by operator (push-based, morsel-driven).
+ *
+ * The non-blocking operators TableScan and Projection are fused into the pipeline of their input: their predicates
+ * and expressions are rewritten to refer to the columns of the table at the bottom of the pipeline, so that a fused
+ * pipeline consists of a list of predicates and a list of output expressions over that table. The table is split
+ * into morsels, i.e., chunks or slices of at most MORSEL_SIZE rows. One job per worker pulls the next morsel from a
+ * shared counter, applies all predicates to it, evaluates the output expressions on the remaining rows and pushes the
+ * resulting batch directly into the pipeline breaker:
+ *  - An Aggregate pre-aggregates every batch right away, so that the rows pass all operators of the pipeline in a
+ *    single pass over each input chunk, without any intermediate table.
+ *  - Any other operator (e.g., a Sort or the build side of a JoinHash) receives the batches as the chunks of a table
+ *    of ReferenceSegments (for plain columns) and ValueSegments (for computed columns), which is also the result if
+ *    the last operator of the plan is fused.
+ *
+ * The output of every operator is the same as if it had been executed on its own.
+ */
+class PipelineExecutor {
+ public:
+  static constexpr auto MORSEL_SIZE = ChunkOffset{65'536};
+
+  explicit PipelineExecutor(const std::shared_ptr<AbstractOperator>& root);
+
+  // executes the plan and returns the output of its root operator
+  std::shared_ptr<const Table> execute();
+
+ protected:
+  // The fused operators on top of a source table
+  struct Pipeline {
+    std::shared_ptr<const Table> source;
+    std::vector<std::shared_ptr<AbstractExpression>> predicates;
+    std::vector<std::shared_ptr<AbstractExpression>> output_expressions;
+    // Has no rows, only provides the names and types of the output columns
+    std::shared_ptr<Table> output_definition;
+  };
+
+  struct Morsel {
+    ChunkID chunk_id;
+    ChunkOffset begin;
+    ChunkOffset end;
+  };
+
+  // executes an operator and its inputs, and stores the result as the output of the operator
+  std::shared_ptr<const Table> _execute(const std::shared_ptr<AbstractOperator>& op);
+
+  // fuses an operator with the non-blocking operators below it, executing the operators below the pipeline
+  Pipeline _compile(const std::shared_ptr<AbstractOperator>& op);
+
+  static std::vector<Morsel> _split_into_morsels(const Table& table);
+
+  // Passes a morsel through the fused operators. If forward_segments is set, the output may reuse the segments of
+  // the source for morsels that cover a whole chunk and pass all predicates. Otherwise, plain columns are always
+  // emitted as ReferenceSegments, so that every column of the output consists of one segment type only.
+  static std::shared_ptr<Chunk> _process_morsel(const Pipeline& pipeline, const Morsel& morsel,
+                                                const bool forward_segments);
+
+  // runs the pipeline and collects its batches into a table
+  static std::shared_ptr<const Table> _collect(const Pipeline& pipeline);
+
+  const std::shared_ptr<AbstractOperator> _root;
+};
+
+}  // namespace opossum
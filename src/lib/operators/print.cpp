@@ -0,0 +1,83 @@
+#include "print.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+Print::Print(const std::shared_ptr<AbstractOperator> in, std::ostream& out) : AbstractOperator(in), _out(out) {}
+
+const std::string Print::name() const { return "Print"; }
+
+std::vector<size_t> Print::_column_string_widths(const size_t min, const size_t max, const Table& table) const {
+  auto widths = std::vector<size_t>(table.column_count());
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    widths[column_id] = std::max({min, table.column_name(column_id).size(), table.column_type(column_id).size()});
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk_snapshot = table.get_chunk_snapshot(chunk_id);
+    const auto& chunk = *chunk_snapshot;
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      const auto& segment = *chunk.get_segment(column_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+        widths[column_id] = std::max(widths[column_id], to_string(segment[chunk_offset]).size());
+      }
+    }
+  }
+
+  for (auto& width : widths) {
+    width = std::min(width, max);
+  }
+  return widths;
+}
+
+std::shared_ptr<const Table> Print::_on_execute() {
+  // Printing is slow anyway, so we do not warn about the use of BaseSegment::operator[]
+  PerformanceWarningDisabler performance_warning_disabler;
+
+  const auto table = _input_table_left();
+  const auto widths = _column_string_widths(8, 20, *table);
+
+  _out << "=== Columns" << std::endl;
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    _out << "|" << std::setw(widths[column_id]) << table->column_name(column_id) << std::setw(0);
+  }
+  _out << "|" << std::endl;
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    _out << "|" << std::setw(widths[column_id]) << table->column_type(column_id) << std::setw(0);
+  }
+  _out << "|" << std::endl;
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk_snapshot = table->get_chunk_snapshot(chunk_id);
+    const auto& chunk = *chunk_snapshot;
+    _out << "=== Chunk " << chunk_id << " === " << std::endl;
+
+    if (chunk.size() == 0) {
+      _out << "Empty chunk." << std::endl;
+      continue;
+    }
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+        auto value = to_string((*chunk.get_segment(column_id))[chunk_offset]);
+        // Values that do not fit are cut off
+        if (value.size() > widths[column_id]) value = value.substr(0, widths[column_id] - 3) + "...";
+        _out << "|" << std::setw(widths[column_id]) << value << std::setw(0);
+      }
+      _out << "|" << std::endl;
+    }
+  }
+
+  return table;
+}
+
+}  // namespace opossum
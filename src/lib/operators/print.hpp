@@ -0,0 +1,28 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// operator to print the table with its data. The output table is the input table.
+class Print : public AbstractOperator {
+ public:
+  explicit Print(const std::shared_ptr<AbstractOperator> in, std::ostream& out = std::cout);
+
+  const std::string name() const override;
+
+ protected:
+  // returns the width of every column, i.e., the length of its longest value clamped to [min, max]
+  std::vector<size_t> _column_string_widths(const size_t min, const size_t max, const Table& table) const;
+
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::ostream& _out;
+};
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#include "projection.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/column_expression.hpp"
+#include "expression/expression_evaluator.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+Projection::Projection(const std::shared_ptr<AbstractOperator> in,
+                       const std::vector<std::shared_ptr<AbstractExpression>>& expressions)
+    : AbstractOperator(in), _expressions(expressions) {}
+
+const std::vector<std::shared_ptr<AbstractExpression>>& Projection::expressions() const { return _expressions; }
+
+const std::string Projection::name() const { return "Projection"; }
+
+std::shared_ptr<const Table> Projection::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  auto output_table = std::make_shared<Table>();
+  for (const auto& expression : _expressions) {
+    output_table->add_column(expression->description(*input_table),
+                             data_type_to_string(expression->data_type(*input_table)));
+  }
+
+  auto output_chunks = std::vector<Chunk>(input_table->chunk_count());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto input_chunk_snapshot = input_table->get_chunk_snapshot(chunk_id);
+      const auto& input_chunk = *input_chunk_snapshot;
+      const auto evaluator = ExpressionEvaluator{input_table, chunk_id};
+
+      // Forwarded columns of a data table share the positions of all rows of the chunk
+      auto chunk_pos_list = std::shared_ptr<PosList>{};
+
+      auto& output_chunk = output_chunks[chunk_id];
+      for (const auto& expression : _expressions) {
+        if (expression->type() != ExpressionType::Column) {
+          output_chunk.add_segment(evaluator.evaluate_to_segment(*expression));
+          continue;
+        }
+
+        const auto column_id = static_cast<const ColumnExpression&>(*expression).column_id();
+        const auto segment = input_chunk.get_segment(column_id);
+        if (std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+          output_chunk.add_segment(segment);
+          continue;
+        }
+
+        if (!chunk_pos_list) {
+          chunk_pos_list = std::make_shared<PosList>(input_chunk.size());
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk.size(); ++chunk_offset) {
+            (*chunk_pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+          }
+        }
+        output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, chunk_pos_list));
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (auto& output_chunk : output_chunks) output_table->emplace_chunk(std::move(output_chunk));
+  return output_table;
+}
+
+}  // namespace opossum
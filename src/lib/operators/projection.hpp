@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Computes one output column per expression (SELECT a, b * c + 1, ...). The column names are the descriptions of the
+ * expressions. Columns that are taken from the input without any computation (i.e., ColumnExpressions) are forwarded
+ * as ReferenceSegments, so that their values are not copied. All other expressions are evaluated chunk by chunk, with
+ * one job per chunk, into ValueSegments.
+ */
+class Projection : public AbstractOperator {
+ public:
+  Projection(const std::shared_ptr<AbstractOperator> in,
+             const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
+  const std::vector<std::shared_ptr<AbstractExpression>>& expressions() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<std::shared_ptr<AbstractExpression>> _expressions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,276 @@
+#include "sort.hpp"
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Writes the lower width bytes of value into key, most significant byte first, so that keys can be compared byte by
+// byte. Descending columns are inverted.
+void write_key_bytes(uint8_t* key, const uint64_t value, const size_t width, const OrderByMode order_by_mode) {
+  const auto ordered_value = order_by_mode == OrderByMode::Ascending ? value : ~value;
+  for (auto byte_index = size_t{0}; byte_index < width; ++byte_index) {
+    key[byte_index] = static_cast<uint8_t>(ordered_value >> (8 * (width - 1 - byte_index)));
+  }
+}
+
+// Transforms a number into an unsigned integer of the same width with the same order
+template <typename T>
+uint64_t normalize_number(const T value) {
+  static_assert(std::is_arithmetic_v<T>, "Only numbers can be normalized");
+  using Unsigned = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+  constexpr auto sign_bit = Unsigned{1} << (sizeof(T) * 8 - 1);
+
+  if constexpr (std::is_integral_v<T>) {
+    // Flipping the sign bit moves the negative numbers below the positive ones
+    return static_cast<Unsigned>(value) ^ sign_bit;
+  } else {
+    // -0.0 and 0.0 are equal, but differ in their sign bit
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    auto bits = Unsigned{0};
+    std::memcpy(&bits, &normalized_value, sizeof(bits));
+    // Negative numbers are stored as sign and magnitude, so all their bits are flipped to reverse their order
+    return bits & sign_bit ? ~bits : bits | sign_bit;
+  }
+}
+
+// A sort column, which normalizes the values of a chunk into keys and compares values across chunks
+class BaseSortColumn {
+ public:
+  virtual ~BaseSortColumn() = default;
+
+  // The number of bytes that a value of this segment takes up in the normalized keys
+  virtual size_t key_width(const BaseSegment& segment) const = 0;
+
+  // Writes the normalized keys of all rows of a chunk into keys, which has a key of key_stride bytes per row. Also
+  // keeps the values of the chunk for compare().
+  virtual void normalize(const ChunkID chunk_id, const BaseSegment& segment, uint8_t* keys,
+                         const size_t key_stride) = 0;
+
+  // Compares the values of two rows of (possibly) different chunks, returns a negative number if left comes first
+  virtual int compare(const RowID& left, const RowID& right) const = 0;
+};
+
+template <typename T>
+class SortColumn : public BaseSortColumn {
+ public:
+  SortColumn(const ChunkID chunk_count, const OrderByMode order_by_mode)
+      : _order_by_mode(order_by_mode), _values(chunk_count) {}
+
+  size_t key_width(const BaseSegment& segment) const override {
+    if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      return dictionary_segment->attribute_vector()->width();
+    }
+    return std::is_same_v<T, std::string> ? sizeof(ValueID) : sizeof(T);
+  }
+
+  void normalize(const ChunkID chunk_id, const BaseSegment& segment, uint8_t* keys, const size_t key_stride) override {
+    auto& values = _values[chunk_id];
+    values.reserve(segment.size());
+    segment_for_each<T>(segment, [&](const ChunkOffset, const SegmentValue<T>& value) { values.push_back(value); });
+    const auto row_count = values.size();
+    const auto width = key_width(segment);
+
+    if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      resolve_attribute_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+        const auto& value_ids = attribute_vector.values();
+        for (auto chunk_offset = size_t{0}; chunk_offset < row_count; ++chunk_offset) {
+          write_key_bytes(keys + chunk_offset * key_stride, value_ids[chunk_offset], width, _order_by_mode);
+        }
+      });
+    } else if constexpr (std::is_same_v<T, std::string>) {  // NOLINT
+      // Strings do not have a fixed width, so they are represented by their rank among the values of the chunk
+      auto distinct_values = values;
+      std::sort(distinct_values.begin(), distinct_values.end());
+      distinct_values.erase(std::unique(distinct_values.begin(), distinct_values.end()), distinct_values.end());
+      for (auto chunk_offset = size_t{0}; chunk_offset < row_count; ++chunk_offset) {
+        const auto rank = std::lower_bound(distinct_values.begin(), distinct_values.end(), values[chunk_offset]) -
+                          distinct_values.begin();
+        write_key_bytes(keys + chunk_offset * key_stride, static_cast<uint64_t>(rank), width, _order_by_mode);
+      }
+    } else {
+      for (auto chunk_offset = size_t{0}; chunk_offset < row_count; ++chunk_offset) {
+        write_key_bytes(keys + chunk_offset * key_stride, normalize_number(values[chunk_offset]), width,
+                        _order_by_mode);
+      }
+    }
+  }
+
+  int compare(const RowID& left, const RowID& right) const override {
+    const auto& left_value = _values[left.chunk_id][left.chunk_offset];
+    const auto& right_value = _values[right.chunk_id][right.chunk_offset];
+    const auto direction = _order_by_mode == OrderByMode::Ascending ? 1 : -1;
+    if (left_value < right_value) return -direction;
+    if (right_value < left_value) return direction;
+    return 0;
+  }
+
+ protected:
+  const OrderByMode _order_by_mode;
+  std::vector<std::vector<SegmentValue<T>>> _values;
+};
+
+// Sorts the rows of a chunk by their normalized keys. The LSD radix sort makes one stable counting sort pass per key
+// byte, starting with the least significant one. Passes over bytes that are equal for all rows are skipped.
+std::vector<ChunkOffset> radix_sort(const std::vector<uint8_t>& keys, const size_t key_width,
+                                    const ChunkOffset row_count) {
+  auto chunk_offsets = std::vector<ChunkOffset>(row_count);
+  std::iota(chunk_offsets.begin(), chunk_offsets.end(), ChunkOffset{0});
+  auto sorted_chunk_offsets = std::vector<ChunkOffset>(row_count);
+
+  for (auto byte_index = key_width; byte_index-- > 0;) {
+    auto bucket_offsets = std::array<size_t, 256>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      ++bucket_offsets[keys[chunk_offset * key_width + byte_index]];
+    }
+    if (std::find(bucket_offsets.begin(), bucket_offsets.end(), row_count) != bucket_offsets.end()) continue;
+
+    auto bucket_begin = size_t{0};
+    for (auto& bucket_offset : bucket_offsets) {
+      const auto bucket_size = bucket_offset;
+      bucket_offset = bucket_begin;
+      bucket_begin += bucket_size;
+    }
+    for (const auto chunk_offset : chunk_offsets) {
+      sorted_chunk_offsets[bucket_offsets[keys[chunk_offset * key_width + byte_index]]++] = chunk_offset;
+    }
+    std::swap(chunk_offsets, sorted_chunk_offsets);
+  }
+
+  return chunk_offsets;
+}
+
+}  // namespace
+
+Sort::Sort(const std::shared_ptr<AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions)
+    : AbstractOperator(in), _sort_definitions(sort_definitions) {}
+
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
+
+const std::string Sort::name() const { return "Sort"; }
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(!_sort_definitions.empty(), "Sort needs at least one sort column");
+
+  auto sort_columns = std::vector<std::unique_ptr<BaseSortColumn>>{};
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column_id < input_table->column_count(), "Sort column does not exist");
+    sort_columns.emplace_back(make_unique_by_data_type<BaseSortColumn, SortColumn>(
+        input_table->column_data_type(sort_definition.column_id), input_table->chunk_count(),
+        sort_definition.order_by_mode));
+  }
+
+  // 1. Sort every chunk by its normalized keys
+  auto runs = std::vector<PosList>(input_table->chunk_count());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_snapshot = input_table->get_chunk_snapshot(chunk_id);
+      const auto& chunk = *chunk_snapshot;
+      const auto row_count = static_cast<ChunkOffset>(chunk.size());
+
+      auto key_width = size_t{0};
+      for (auto sort_column_id = size_t{0}; sort_column_id < sort_columns.size(); ++sort_column_id) {
+        key_width += sort_columns[sort_column_id]->key_width(
+            *chunk.get_segment(_sort_definitions[sort_column_id].column_id));
+      }
+
+      auto keys = std::vector<uint8_t>(row_count * key_width);
+      auto key_offset = size_t{0};
+      for (auto sort_column_id = size_t{0}; sort_column_id < sort_columns.size(); ++sort_column_id) {
+        const auto& segment = *chunk.get_segment(_sort_definitions[sort_column_id].column_id);
+        sort_columns[sort_column_id]->normalize(chunk_id, segment, keys.data() + key_offset, key_width);
+        key_offset += sort_columns[sort_column_id]->key_width(segment);
+      }
+
+      auto& run = runs[chunk_id];
+      run.reserve(row_count);
+      const auto is_presorted = _sort_definitions.size() == 1 &&
+                                _sort_definitions.front().order_by_mode == OrderByMode::Ascending &&
+                                chunk.ordered_by() == _sort_definitions.front().column_id;
+      if (is_presorted) {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+          run.push_back(RowID{chunk_id, chunk_offset});
+        }
+        DebugAssert(std::is_sorted(run.begin(), run.end(),
+                                   [&](const RowID& left, const RowID& right) {
+                                     return sort_columns.front()->compare(left, right) < 0;
+                                   }),
+                    "Chunk is flagged as sorted but is not");
+        return;
+      }
+
+      for (const auto chunk_offset : radix_sort(keys, key_width, row_count)) {
+        run.push_back(RowID{chunk_id, chunk_offset});
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // 2. Merge neighboring runs until a single one is left. Ties are resolved in favor of the left run, which keeps the
+  //    sort stable.
+  const auto row_less = [&](const RowID& left, const RowID& right) {
+    for (const auto& sort_column : sort_columns) {
+      const auto comparison = sort_column->compare(left, right);
+      if (comparison != 0) return comparison < 0;
+    }
+    return false;
+  };
+
+  while (runs.size() > 1) {
+    auto merged_runs = std::vector<PosList>((runs.size() + 1) / 2);
+    jobs.clear();
+    for (auto run_index = size_t{0}; run_index < runs.size(); run_index += 2) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, run_index]() {
+        auto& merged_run = merged_runs[run_index / 2];
+        if (run_index + 1 == runs.size()) {
+          merged_run = std::move(runs[run_index]);
+          return;
+        }
+        const auto& left_run = runs[run_index];
+        const auto& right_run = runs[run_index + 1];
+        merged_run.reserve(left_run.size() + right_run.size());
+        std::merge(left_run.begin(), left_run.end(), right_run.begin(), right_run.end(),
+                   std::back_inserter(merged_run), row_less);
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+    runs = std::move(merged_runs);
+  }
+
+  const auto pos_list = std::make_shared<PosList>(runs.empty() ? PosList{} : std::move(runs.front()));
+
+  auto output_table = std::make_shared<Table>();
+  _add_output_columns(*input_table, *output_table);
+  auto output_chunk = Chunk{};
+  _add_reference_segments(input_table, pos_list, output_chunk);
+  if (_sort_definitions.front().order_by_mode == OrderByMode::Ascending) {
+    output_chunk.set_ordered_by(_sort_definitions.front().column_id);
+  }
+  output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+}  // namespace opossum
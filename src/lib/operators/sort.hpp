@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class OrderByMode { Ascending, Descending };
+
+struct SortColumnDefinition {
+  ColumnID column_id;
+  OrderByMode order_by_mode = OrderByMode::Ascending;
+};
+
+/**
+ * Sorts the input by one or more columns (ORDER BY). The sort is stable, and the output is a single chunk of
+ * ReferenceSegments, so that no values are copied. If the first sort column is sorted ascending, the output chunk is
+ * flagged as ordered by it.
+ *
+ * 1. Every chunk is sorted by its own job. For this, the sort columns of a row are normalized into a fixed-width key
+ *    that can be compared byte by byte: DictionarySegments contribute their (order-preserving) ValueIDs, other
+ *    strings their rank within the chunk, and numbers their bits, transformed so that their order is kept. The keys
+ *    are then sorted with an LSD radix sort, skipping the bytes that are equal for all rows.
+ * 2. As the keys are only comparable within a chunk, the sorted chunks are merged pairwise by their values, with the
+ *    merges of a round running in parallel.
+ */
+class Sort : public AbstractOperator {
+ public:
+  Sort(const std::shared_ptr<AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+};
+
+}  // namespace opossum
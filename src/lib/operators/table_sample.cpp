@@ -0,0 +1,95 @@
+#include "table_sample.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableSample::TableSample(const std::shared_ptr<AbstractOperator> in, const double chunk_fraction,
+                         const double row_fraction, const uint64_t seed)
+    : AbstractOperator(in), _chunk_fraction(chunk_fraction), _row_fraction(row_fraction), _seed(seed) {
+  Assert(chunk_fraction > 0.0 && chunk_fraction <= 1.0, "The chunk fraction has to be in (0, 1]");
+  Assert(row_fraction > 0.0 && row_fraction <= 1.0, "The row fraction has to be in (0, 1]");
+}
+
+double TableSample::chunk_fraction() const { return _chunk_fraction; }
+
+double TableSample::row_fraction() const { return _row_fraction; }
+
+uint64_t TableSample::seed() const { return _seed; }
+
+size_t TableSample::input_chunk_count() const { return _input_chunk_count; }
+
+size_t TableSample::sampled_chunk_count() const { return _sampled_chunk_count; }
+
+const std::string TableSample::name() const { return "TableSample"; }
+
+std::shared_ptr<const Table> TableSample::_on_execute() {
+  const auto input_table = _input_table_left();
+  _input_chunk_count = input_table->chunk_count();
+
+  // std::sample keeps the drawn chunks in their order
+  const auto sample_size = std::max(
+      size_t{1}, static_cast<size_t>(std::llround(_chunk_fraction * static_cast<double>(_input_chunk_count))));
+  auto chunk_ids = std::vector<ChunkID::base_type>(_input_chunk_count);
+  std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID::base_type{0});
+  auto sampled_chunk_ids = std::vector<ChunkID::base_type>{};
+  sampled_chunk_ids.reserve(std::min(sample_size, _input_chunk_count));
+  auto random_engine = std::mt19937_64{_seed};
+  std::sample(chunk_ids.cbegin(), chunk_ids.cend(), std::back_inserter(sampled_chunk_ids), sample_size, random_engine);
+  _sampled_chunk_count = sampled_chunk_ids.size();
+
+  auto output_chunks = std::vector<Chunk>(sampled_chunk_ids.size());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(sampled_chunk_ids.size());
+  for (auto sample_index = size_t{0}; sample_index < sampled_chunk_ids.size(); ++sample_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, sample_index]() {
+      const auto chunk_id = ChunkID{sampled_chunk_ids[sample_index]};
+      const auto row_count = input_table->get_chunk_snapshot(chunk_id)->size();
+
+      auto pos_list = std::make_shared<PosList>();
+      if (_row_fraction == 1.0) {
+        pos_list->reserve(row_count);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+          pos_list->push_back(RowID{chunk_id, chunk_offset});
+        }
+      } else {
+        auto seed_sequence = std::seed_seq{static_cast<uint32_t>(_seed), static_cast<uint32_t>(_seed >> 32),
+                                           static_cast<uint32_t>(chunk_id)};
+        auto chunk_random_engine = std::mt19937_64{seed_sequence};
+        // the number of rows that are skipped before the next sampled row
+        auto gap = std::geometric_distribution<uint64_t>{_row_fraction};
+        pos_list->reserve(static_cast<size_t>(std::ceil(_row_fraction * row_count)));
+        for (auto chunk_offset = gap(chunk_random_engine); chunk_offset < row_count;
+             chunk_offset += 1 + gap(chunk_random_engine)) {
+          pos_list->push_back(RowID{chunk_id, static_cast<ChunkOffset>(chunk_offset)});
+        }
+      }
+      if (pos_list->empty()) return;
+
+      _add_reference_segments(input_table, pos_list, output_chunks[sample_index]);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto output_table = std::make_shared<Table>();
+  _add_output_columns(*input_table, *output_table);
+  for (auto& output_chunk : output_chunks) {
+    if (output_chunk.column_count() > 0) output_table->emplace_chunk(std::move(output_chunk));
+  }
+  return output_table;
+}
+
+}  // namespace opossum
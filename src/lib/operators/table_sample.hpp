@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Emits a random sample of the rows of the input, e.g., to answer exploratory queries approximately (see
+ * ApproximateAggregate).
+ *
+ * 1. chunk_fraction of the chunks (at least one) are drawn at random without replacement.
+ * 2. If row_fraction is below 1, every row of a drawn chunk is kept with that probability (Bernoulli sampling). The
+ *    gaps between kept rows are drawn from a geometric distribution, so that skipped rows are never visited.
+ *
+ * Only the drawn chunks and rows are touched, so that the cost is proportional to the size of the sample, not to that
+ * of the input. Every drawn chunk becomes one output chunk of ReferenceSegments (drawn chunks without sampled rows are
+ * left out). The same seed yields the same sample of the same input: every chunk has its own random engine, seeded
+ * from the seed and its ChunkID, and the chunks are sampled by one job each.
+ */
+class TableSample : public AbstractOperator {
+ public:
+  TableSample(const std::shared_ptr<AbstractOperator> in, const double chunk_fraction, const double row_fraction = 1.0,
+              const uint64_t seed = 0);
+
+  double chunk_fraction() const;
+  double row_fraction() const;
+  uint64_t seed() const;
+
+  // valid once the operator was executed: the number of chunks of the input and of the chunks that were drawn
+  size_t input_chunk_count() const;
+  size_t sampled_chunk_count() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const double _chunk_fraction;
+  const double _row_fraction;
+  const uint64_t _seed;
+  size_t _input_chunk_count = 0;
+  size_t _sampled_chunk_count = 0;
+};
+
+}  // namespace opossum
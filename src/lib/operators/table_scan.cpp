@@ -0,0 +1,89 @@
+#include "table_scan.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/segment_scan.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableScan::TableScan(const std::shared_ptr<AbstractOperator> in, const ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant search_value)
+    : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {}
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+const std::string TableScan::name() const { return "TableScan"; }
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(_column_id < input_table->column_count(), "Scan column does not exist");
+  const auto data_type = input_table->column_data_type(_column_id);
+
+  auto chunk_matches = std::vector<std::shared_ptr<PosList>>(input_table->chunk_count());
+  auto chunk_ordered_by = std::vector<std::optional<ColumnID>>(input_table->chunk_count());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_snapshot = input_table->get_chunk_snapshot(chunk_id);
+      const auto& chunk = *chunk_snapshot;
+      const auto& segment = *chunk.get_segment(_column_id);
+      auto matches = std::make_shared<PosList>();
+      const auto is_reference_segment = dynamic_cast<const ReferenceSegment*>(&segment) != nullptr;
+
+      if (chunk.ordered_by() == _column_id && !is_reference_segment && _scan_type != ScanType::OpNotEquals) {
+        const auto range = scan_sorted_segment(segment, data_type, _scan_type, _search_value);
+        matches->reserve(range.size());
+        for (auto chunk_offset = range.begin; chunk_offset < range.end; ++chunk_offset) {
+          matches->push_back(RowID{chunk_id, chunk_offset});
+        }
+      } else if (is_reference_segment) {
+        resolve_data_type(data_type, [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          const auto typed_search_value = type_cast<ColumnDataType>(_search_value);
+          resolve_scan_type(_scan_type, [&](const auto& comparator) {
+            segment_for_each<ColumnDataType>(segment, [&](const ChunkOffset chunk_offset, const auto& value) {
+              if (comparator(value, typed_search_value)) matches->push_back(RowID{chunk_id, chunk_offset});
+            });
+          });
+        });
+      } else {
+        scan_segment(segment, data_type, _scan_type, _search_value, chunk_id, *matches);
+      }
+
+      chunk_matches[chunk_id] = std::move(matches);
+      chunk_ordered_by[chunk_id] = chunk.ordered_by();
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto output_table = std::make_shared<Table>();
+  _add_output_columns(*input_table, *output_table);
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto& matches = chunk_matches[chunk_id];
+    if (matches->empty()) continue;
+    auto output_chunk = Chunk{};
+    _add_reference_segments(input_table, matches, output_chunk);
+    // A scan keeps the order of the rows
+    if (chunk_ordered_by[chunk_id]) output_chunk.set_ordered_by(*chunk_ordered_by[chunk_id]);
+    output_table->emplace_chunk(std::move(output_chunk));
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Emits the rows of the input for which `column <scan_type> search_value` holds (WHERE column = 5). The search value
+ * is converted into the type of the column first. Every chunk is scanned by its own job with scan_segment, so that
+ * DictionarySegments are scanned on their ValueIDs. Chunks that are ordered by the scanned column are not scanned at
+ * all: their matches are a range of rows that is found by binary search (see scan_sorted_segment). The output
+ * consists of one chunk of ReferenceSegments per input chunk with matches, which keeps the ordered_by flag of its
+ * input chunk.
+ */
+class TableScan : public AbstractOperator {
+ public:
+  TableScan(const std::shared_ptr<AbstractOperator> in, const ColumnID column_id, const ScanType scan_type,
+            const AllTypeVariant search_value);
+
+  ColumnID column_id() const;
+  ScanType scan_type() const;
+  const AllTypeVariant& search_value() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+};
+
+}  // namespace opossum
@@ -0,0 +1,14 @@
+#include "table_wrapper.hpp"
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+TableWrapper::TableWrapper(const std::shared_ptr<const Table> table) : _table(table) {}
+
+const std::string TableWrapper::name() const { return "TableWrapper"; }
+
+std::shared_ptr<const Table> TableWrapper::_on_execute() { return _table; }
+
+}  // namespace opossum
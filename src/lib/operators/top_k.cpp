@@ -0,0 +1,155 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_queue_scheduler.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename Value>
+struct HeapEntry {
+  Value value;
+  RowID row_id;
+};
+
+// Returns the positions of the first k rows when sorted by a column, with value_less being std::less<> or
+// std::greater<>
+template <typename T, typename ValueLess>
+std::shared_ptr<PosList> top_k(const Table& table, const ColumnID column_id, const size_t k, const size_t job_count,
+                               const ValueLess& value_less) {
+  using Value = SegmentValue<T>;
+  using Entry = HeapEntry<Value>;
+
+  // Ties are resolved by the position of the rows, so that the result is the same as that of a stable sort
+  const auto entry_less = [&](const Entry& left, const Entry& right) {
+    if (value_less(left.value, right.value)) return true;
+    if (value_less(right.value, left.value)) return false;
+    return left.row_id < right.row_id;
+  };
+
+  // The best value of every chunk that is stored in a DictionarySegment
+  const auto chunk_count = table.chunk_count();
+  auto chunk_bounds = std::vector<std::optional<Value>>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto segment_ptr = table.get_chunk_snapshot(chunk_id)->get_segment(column_id);
+    const auto& segment = *segment_ptr;
+    if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      const auto& dictionary = *dictionary_segment->dictionary();
+      if (dictionary.empty()) continue;
+      chunk_bounds[chunk_id] = value_less(dictionary.front(), dictionary.back()) ? Value{dictionary.front()}
+                                                                                  : Value{dictionary.back()};
+    }
+  }
+
+  // Chunks without a bound come first, as they cannot be skipped anyway. The others are visited from the best to the
+  // worst bound, so that the heaps quickly fill up with good values.
+  auto chunk_ids = std::vector<ChunkID>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) chunk_ids[chunk_id] = chunk_id;
+  std::stable_sort(chunk_ids.begin(), chunk_ids.end(), [&](const ChunkID left, const ChunkID right) {
+    const auto& left_bound = chunk_bounds[left];
+    const auto& right_bound = chunk_bounds[right];
+    if (!left_bound || !right_bound) return !left_bound && right_bound;
+    return value_less(*left_bound, *right_bound);
+  });
+
+  // The heaps are max-heaps with respect to entry_less, i.e., their front is the worst of the best rows seen so far
+  auto heaps = std::vector<std::vector<Entry>>(job_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      auto& heap = heaps[job_id];
+      heap.reserve(k);
+
+      for (auto chunk_index = job_id; chunk_index < chunk_ids.size(); chunk_index += job_count) {
+        const auto chunk_id = chunk_ids[chunk_index];
+        const auto& bound = chunk_bounds[chunk_id];
+        // All rows of this chunk, and of the following ones, are worse than the rows in the heap
+        if (heap.size() == k && bound && value_less(heap.front().value, *bound)) break;
+
+        const auto segment_ptr = table.get_chunk_snapshot(chunk_id)->get_segment(column_id);
+        const auto& segment = *segment_ptr;
+        segment_for_each<T>(segment, [&](const ChunkOffset chunk_offset, const Value& value) {
+          const auto entry = Entry{value, RowID{chunk_id, chunk_offset}};
+          if (heap.size() < k) {
+            heap.push_back(entry);
+            std::push_heap(heap.begin(), heap.end(), entry_less);
+          } else if (entry_less(entry, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), entry_less);
+            heap.back() = entry;
+            std::push_heap(heap.begin(), heap.end(), entry_less);
+          }
+        });
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto entries = std::vector<Entry>{};
+  for (const auto& heap : heaps) entries.insert(entries.end(), heap.begin(), heap.end());
+  std::sort(entries.begin(), entries.end(), entry_less);
+  if (entries.size() > k) entries.resize(k);
+
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->reserve(entries.size());
+  for (const auto& entry : entries) pos_list->push_back(entry.row_id);
+  return pos_list;
+}
+
+}  // namespace
+
+TopK::TopK(const std::shared_ptr<AbstractOperator> in, const SortColumnDefinition& sort_definition, const size_t k)
+    : AbstractOperator(in), _sort_definition(sort_definition), _k(k) {}
+
+const SortColumnDefinition& TopK::sort_definition() const { return _sort_definition; }
+
+size_t TopK::k() const { return _k; }
+
+const std::string TopK::name() const { return "TopK"; }
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto column_id = _sort_definition.column_id;
+  Assert(column_id < input_table->column_count(), "Sort column does not exist");
+
+  const auto scheduler = CurrentScheduler::get();
+  const auto job_count = std::min(size_t{scheduler ? scheduler->worker_count() : 1},
+                                  static_cast<size_t>(input_table->chunk_count()));
+
+  auto pos_list = std::make_shared<PosList>();
+  if (_k > 0) {
+    resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      if (_sort_definition.order_by_mode == OrderByMode::Ascending) {
+        pos_list = top_k<ColumnDataType>(*input_table, column_id, _k, job_count, std::less<>{});
+      } else {
+        pos_list = top_k<ColumnDataType>(*input_table, column_id, _k, job_count, std::greater<>{});
+      }
+    });
+  }
+
+  auto output_table = std::make_shared<Table>();
+  _add_output_columns(*input_table, *output_table);
+  auto output_chunk = Chunk{};
+  _add_reference_segments(input_table, pos_list, output_chunk);
+  if (_sort_definition.order_by_mode == OrderByMode::Ascending) output_chunk.set_ordered_by(column_id);
+  output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+}  // namespace opossum
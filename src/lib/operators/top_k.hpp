@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Emits the first k rows of the input when sorted by a single column (ORDER BY ... LIMIT k) without sorting the whole
+ * input. The output is the same as that of a Sort followed by a Limit, i.e., ties are resolved by the position of the
+ * rows in the input.
+ *
+ * The chunks are distributed among one job per worker, each of which keeps its best k rows in a bounded heap. For
+ * chunks that are stored in a DictionarySegment, the first (or last) dictionary entry tells the best value of the
+ * chunk without reading it. Every job visits its chunks from the best to the worst such bound and stops as soon as a
+ * chunk cannot contribute to its heap anymore. Finally, the heaps are merged.
+ */
+class TopK : public AbstractOperator {
+ public:
+  TopK(const std::shared_ptr<AbstractOperator> in, const SortColumnDefinition& sort_definition, const size_t k);
+
+  const SortColumnDefinition& sort_definition() const;
+  size_t k() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const SortColumnDefinition _sort_definition;
+  const size_t _k;
+};
+
+}  // namespace opossum
@@ -1,23 +1,97 @@
 #pragma once
 
+#include <boost/hana/append.hpp>
+#include <boost/hana/at.hpp>
 #include <boost/hana/equal.hpp>
+#include <boost/hana/first.hpp>
 #include <boost/hana/for_each.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/range.hpp>
 #include <boost/hana/size.hpp>
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "all_type_variant.hpp"
+#include "type_cast.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "storage/string_heap_segment.hpp"
 #include "storage/value_segment.hpp"
 
 namespace opossum {
 
 namespace hana = boost::hana;
 
+namespace detail {
+
+static constexpr auto data_type_indices = hana::make_range(hana::size_c<0>, hana::size(data_types));
+
+/**
+ * The compile-time list of segment types that hold values of type T, paired with their encoding. Every kernel that is
+ * resolved with resolve_segment_type is instantiated once for each of them.
+ */
+template <typename T>
+constexpr auto segment_types() {
+  constexpr auto common_segment_types =
+      hana::make_tuple(hana::make_pair(hana::integral_c<SegmentEncoding, SegmentEncoding::Unencoded>,
+                                       hana::type_c<ValueSegment<T>>),
+                       hana::make_pair(hana::integral_c<SegmentEncoding, SegmentEncoding::Dictionary>,
+                                       hana::type_c<DictionarySegment<T>>));
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    return hana::append(common_segment_types,
+                        hana::make_pair(hana::integral_c<SegmentEncoding, SegmentEncoding::StringHeap>,
+                                        hana::type_c<StringHeapSegment>));
+  } else {
+    return common_segment_types;
+  }
+}
+
+}  // namespace detail
+
+// The DataType that corresponds to T, e.g., DataType::Int for int32_t
+template <typename T>
+constexpr DataType data_type_of = static_cast<DataType>(detail::index_of(types, hana::type_c<T>));
+
+// Returns the DataType of a type string, e.g., DataType::Int for "int"
+inline DataType data_type_from_string(const std::string& type_string) {
+  auto data_type = std::optional<DataType>{};
+  hana::for_each(detail::data_type_indices, [&](auto index) {
+    if (type_string == hana::first(hana::at(data_types, index))) data_type = static_cast<DataType>(index.value);
+  });
+  Assert(data_type, "unknown type " + type_string);
+  return *data_type;
+}
+
+// Returns the type string of a DataType, e.g., "int" for DataType::Int
+inline std::string data_type_to_string(const DataType data_type) {
+  auto type_string = std::string{};
+  hana::for_each(detail::data_type_indices, [&](auto index) {
+    if (static_cast<size_t>(data_type) == index) type_string = hana::first(hana::at(data_types, index));
+  });
+  return type_string;
+}
+
+/**
+ * Resolves a DataType by passing a hana::type object on to a generic lambda, see resolve_data_type(std::string, ...)
+ * below. As the DataType is compared as an integer, this is cheap enough to be used once per chunk.
+ */
+template <typename Functor>
+void resolve_data_type(const DataType data_type, const Functor& func) {
+  hana::for_each(detail::data_type_indices, [&](auto index) {
+    // The + before hana::second - which returns a reference - converts its return value into a value
+    if (static_cast<size_t>(data_type) == index) func(+hana::second(hana::at(data_types, index)));
+  });
+}
+
 /**
  * Resolves a type string by creating an instance of a templated class and
  * returning it as a unique_ptr of its non-templated base class.
@@ -61,6 +135,19 @@ std::unique_ptr<Base> make_unique_by_data_type(const std::string& type, Construc
   return ret;
 }
 
+/**
+ * Same as make_unique_by_data_type(std::string, ...), but resolves a DataType without comparing strings.
+ */
+template <class Base, template <typename...> class Impl, class... TemplateArgs, typename... ConstructorArgs>
+std::unique_ptr<Base> make_unique_by_data_type(const DataType data_type, ConstructorArgs&&... args) {
+  std::unique_ptr<Base> ret = nullptr;
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    ret = std::make_unique<Impl<ColumnDataType, TemplateArgs...>>(std::forward<ConstructorArgs>(args)...);
+  });
+  return ret;
+}
+
 /**
  * Convenience function. Calls make_unique_by_data_type and casts the result into a shared_ptr.
  */
@@ -69,6 +156,11 @@ std::shared_ptr<Base> make_shared_by_data_type(const std::string& type, Construc
   return make_unique_by_data_type<Base, impl, TemplateArgs...>(type, std::forward<ConstructorArgs>(args)...);
 }
 
+template <class Base, template <typename...> class impl, class... TemplateArgs, class... ConstructorArgs>
+std::shared_ptr<Base> make_shared_by_data_type(const DataType data_type, ConstructorArgs&&... args) {
+  return make_unique_by_data_type<Base, impl, TemplateArgs...>(data_type, std::forward<ConstructorArgs>(args)...);
+}
+
 /**
  * Resolves a type string by passing a hana::type object on to a generic lambda
  *
@@ -129,4 +221,94 @@ void resolve_data_type(const std::string& type_string, const Functor& func) {
   });
 }
 
+/**
+ * Resolves the concrete type of a segment that holds values of type T and passes the typed segment on to a generic
+ * lambda. The candidates are taken from the compile-time list detail::segment_types<T>(), so the lambda is
+ * instantiated once per segment type and does not need any virtual calls to access the segment's data.
+ *
+ * Example:
+ *
+ *   resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+ *     using Type = typename decltype(type)::type;
+ *     resolve_segment_type<Type>(*chunk.get_segment(column_id), [&](const auto& typed_segment) {
+ *       using SegmentType = std::decay_t<decltype(typed_segment)>;
+ *       ...
+ *     });
+ *   });
+ */
+template <typename T, typename Functor>
+void resolve_segment_type(const BaseSegment& segment, const Functor& func) {
+  auto resolved = false;
+  hana::for_each(detail::segment_types<T>(), [&](auto encoding_and_type) {
+    using SegmentType = typename decltype(+hana::second(encoding_and_type))::type;
+    if (resolved) return;
+    if (const auto* typed_segment = dynamic_cast<const SegmentType*>(&segment)) {
+      resolved = true;
+      func(*typed_segment);
+    }
+  });
+  Assert(resolved, "Unknown segment type");
+}
+
+// Resolves both the data type and the segment type, see resolve_data_type and resolve_segment_type
+template <typename Functor>
+void resolve_data_and_segment_type(const BaseSegment& segment, const DataType data_type, const Functor& func) {
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    resolve_segment_type<ColumnDataType>(segment, [&](const auto& typed_segment) { func(type, typed_segment); });
+  });
+}
+
+// Returns the encoding of a segment that holds values of type T
+template <typename T>
+SegmentEncoding segment_encoding(const BaseSegment& segment) {
+  auto encoding = std::optional<SegmentEncoding>{};
+  hana::for_each(detail::segment_types<T>(), [&](auto encoding_and_type) {
+    using SegmentType = typename decltype(+hana::second(encoding_and_type))::type;
+    if (!encoding && dynamic_cast<const SegmentType*>(&segment)) encoding = hana::first(encoding_and_type);
+  });
+  Assert(encoding, "Unknown segment type");
+  return *encoding;
+}
+
+/**
+ * Resolves the width of a FixedSizeAttributeVector and passes the typed attribute vector on to a generic lambda
+ */
+template <typename Functor>
+void resolve_attribute_vector_type(const BaseAttributeVector& attribute_vector, const Functor& func) {
+  switch (attribute_vector.width()) {
+    case sizeof(uint8_t):
+      return func(static_cast<const FixedSizeAttributeVector<uint8_t>&>(attribute_vector));
+    case sizeof(uint16_t):
+      return func(static_cast<const FixedSizeAttributeVector<uint16_t>&>(attribute_vector));
+    case sizeof(uint32_t):
+      return func(static_cast<const FixedSizeAttributeVector<uint32_t>&>(attribute_vector));
+    default:
+      Fail("Unknown attribute vector width");
+  }
+}
+
+/**
+ * Resolves a ScanType by passing a comparison function object on to a generic lambda. Each ScanType is a distinct
+ * type (e.g., std::less<>), so that the lambda is instantiated once per ScanType and the comparison is inlined.
+ */
+template <typename Functor>
+void resolve_scan_type(const ScanType scan_type, const Functor& func) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return func(std::equal_to<>{});
+    case ScanType::OpNotEquals:
+      return func(std::not_equal_to<>{});
+    case ScanType::OpLessThan:
+      return func(std::less<>{});
+    case ScanType::OpLessThanEquals:
+      return func(std::less_equal<>{});
+    case ScanType::OpGreaterThan:
+      return func(std::greater<>{});
+    case ScanType::OpGreaterThanEquals:
+      return func(std::greater_equal<>{});
+  }
+  Fail("Unknown scan type");
+}
+
 }  // namespace opossum
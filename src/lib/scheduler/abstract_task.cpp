@@ -0,0 +1,76 @@
+#include "abstract_task.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "current_scheduler.hpp"
+#include "task_queue_scheduler.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void AbstractTask::set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor) {
+  Assert(!_is_scheduled && !successor->_is_scheduled, "Dependencies cannot be changed after scheduling");
+  _successors.push_back(successor);
+  ++successor->_pending_predecessor_count;
+}
+
+const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() const { return _successors; }
+
+bool AbstractTask::is_ready() const { return _pending_predecessor_count == 0; }
+
+bool AbstractTask::is_done() const { return _is_done; }
+
+void AbstractTask::schedule() {
+  Assert(!_is_scheduled.exchange(true), "Task was already scheduled");
+  _try_enqueue();
+}
+
+void AbstractTask::join() {
+  if (_is_done) return;
+
+  const auto scheduler = CurrentScheduler::get();
+  if (scheduler) {
+    scheduler->wait_for(*this);
+    return;
+  }
+
+  std::unique_lock lock(_done_mutex);
+  _done_condition.wait(lock, [&]() { return _is_done.load(); });
+}
+
+void AbstractTask::execute() {
+  DebugAssert(is_ready(), "Task cannot be executed before its predecessors are done");
+  DebugAssert(!_is_done, "Task was already executed");
+
+  _on_execute();
+
+  {
+    std::lock_guard lock(_done_mutex);
+    _is_done = true;
+  }
+  _done_condition.notify_all();
+
+  for (const auto& successor : _successors) {
+    successor->_on_predecessor_done();
+  }
+}
+
+void AbstractTask::_on_predecessor_done() {
+  if (--_pending_predecessor_count == 0) _try_enqueue();
+}
+
+void AbstractTask::_try_enqueue() {
+  // schedule() and the last predecessor may race here, but only one of them gets to enqueue the task
+  if (!_is_scheduled || !is_ready() || _is_enqueued.exchange(true)) return;
+
+  const auto scheduler = CurrentScheduler::get();
+  if (scheduler) {
+    scheduler->enqueue(shared_from_this());
+  } else {
+    execute();
+  }
+}
+
+}  // namespace opossum
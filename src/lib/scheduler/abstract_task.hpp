@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A task is a unit of work that is executed by the current scheduler (or right away, if there is none).
+// Tasks can depend on each other: a task is only executed once all of its predecessors are done. This way, a query
+// plan becomes a DAG of tasks in which independent branches run in parallel.
+class AbstractTask : public std::enable_shared_from_this<AbstractTask>, private Noncopyable {
+ public:
+  virtual ~AbstractTask() = default;
+
+  // Makes this task a predecessor of the given task. Has to be called before either task is scheduled.
+  void set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor);
+
+  const std::vector<std::shared_ptr<AbstractTask>>& successors() const;
+
+  // returns whether all predecessors are done
+  bool is_ready() const;
+
+  bool is_done() const;
+
+  // Hands the task over to the current scheduler. It is executed as soon as all of its predecessors are done.
+  // Without a scheduler, a ready task is executed in the calling thread.
+  void schedule();
+
+  // Blocks until the task is done. Threads that wait for a task help executing queued tasks.
+  void join();
+
+  // Executes the task in the calling thread and notifies its successors. Usually called by the scheduler.
+  void execute();
+
+ protected:
+  virtual void _on_execute() = 0;
+
+  void _on_predecessor_done();
+
+  // enqueues the task if it is scheduled and ready, at most once
+  void _try_enqueue();
+
+  std::vector<std::shared_ptr<AbstractTask>> _successors;
+  std::atomic<uint32_t> _pending_predecessor_count{0};
+  std::atomic_bool _is_scheduled{false};
+  std::atomic_bool _is_enqueued{false};
+  std::atomic_bool _is_done{false};
+
+  std::mutex _done_mutex;
+  std::condition_variable _done_condition;
+};
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#include "current_scheduler.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "task_queue_scheduler.hpp"
+
+namespace opossum {
+
+std::shared_ptr<TaskQueueScheduler> CurrentScheduler::_instance;
+
+std::shared_ptr<TaskQueueScheduler> CurrentScheduler::get() { return std::atomic_load(&_instance); }
+
+void CurrentScheduler::set(const std::shared_ptr<TaskQueueScheduler>& scheduler) {
+  const auto previous_scheduler = std::atomic_exchange(&_instance, scheduler);
+  if (previous_scheduler) previous_scheduler->finish();
+}
+
+bool CurrentScheduler::is_set() { return get() != nullptr; }
+
+void CurrentScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  for (const auto& task : tasks) {
+    task->schedule();
+  }
+  for (const auto& task : tasks) {
+    task->join();
+  }
+}
+
+}  // namespace opossum
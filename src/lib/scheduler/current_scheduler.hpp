@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace opossum {
+
+class AbstractTask;
+class TaskQueueScheduler;
+
+// Holds the scheduler that tasks are handed to. Without a scheduler (the default), tasks are executed right away in
+// the thread that schedules them, which keeps tests and single-threaded tools deterministic.
+class CurrentScheduler {
+ public:
+  static std::shared_ptr<TaskQueueScheduler> get();
+
+  // Replaces the current scheduler. The previous one finishes its queued tasks first.
+  static void set(const std::shared_ptr<TaskQueueScheduler>& scheduler);
+
+  static bool is_set();
+
+  // schedules all tasks and waits until they are done
+  static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+ protected:
+  static std::shared_ptr<TaskQueueScheduler> _instance;
+};
+
+}  // namespace opossum
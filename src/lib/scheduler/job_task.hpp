@@ -0,0 +1,20 @@
+#pragma once
+
+#include <functional>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+// A task that runs an arbitrary function, e.g., the processing of one chunk within an operator
+class JobTask : public AbstractTask {
+ public:
+  explicit JobTask(const std::function<void()>& function);
+
+ protected:
+  void _on_execute() override;
+
+  const std::function<void()> _function;
+};
+
+}  // namespace opossum
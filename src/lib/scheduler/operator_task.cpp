@@ -0,0 +1,47 @@
+#include "operator_task.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::shared_ptr<AbstractTask> add_tasks_from_operator(
+    const std::shared_ptr<AbstractOperator>& op, std::vector<std::shared_ptr<AbstractTask>>& tasks,
+    std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractTask>>& task_by_operator) {
+  const auto iter = task_by_operator.find(op);
+  if (iter != task_by_operator.end()) return iter->second;
+
+  const auto task = std::make_shared<OperatorTask>(op);
+  for (const auto& input : {op->input_left(), op->input_right()}) {
+    if (!input) continue;
+    add_tasks_from_operator(input, tasks, task_by_operator)->set_as_predecessor_of(task);
+  }
+
+  // Inputs are added before their consumers
+  tasks.push_back(task);
+  task_by_operator.emplace(op, task);
+  return task;
+}
+
+}  // namespace
+
+OperatorTask::OperatorTask(const std::shared_ptr<AbstractOperator> op) : _op(op) {}
+
+std::vector<std::shared_ptr<AbstractTask>> OperatorTask::make_tasks_from_operator(
+    const std::shared_ptr<AbstractOperator> op) {
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto task_by_operator = std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractTask>>{};
+  add_tasks_from_operator(op, tasks, task_by_operator);
+  return tasks;
+}
+
+const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
+
+void OperatorTask::_on_execute() { _op->execute(); }
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+// Wraps an operator so that it can be executed by the scheduler
+class OperatorTask : public AbstractTask {
+ public:
+  explicit OperatorTask(const std::shared_ptr<AbstractOperator> op);
+
+  // Creates tasks for the operator and all of its (transitive) inputs. An input task is a predecessor of the tasks
+  // of its consumers, so independent inputs run in parallel. Operators that are used by several consumers get a
+  // single task. The task of the given operator, i.e., the root of the plan, is the last one in the list.
+  static std::vector<std::shared_ptr<AbstractTask>> make_tasks_from_operator(
+      const std::shared_ptr<AbstractOperator> op);
+
+  const std::shared_ptr<AbstractOperator>& get_operator() const;
+
+ protected:
+  void _on_execute() override;
+
+  const std::shared_ptr<AbstractOperator> _op;
+};
+
+}  // namespace opossum
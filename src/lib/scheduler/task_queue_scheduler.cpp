@@ -0,0 +1,79 @@
+#include "task_queue_scheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+TaskQueueScheduler::TaskQueueScheduler(const uint32_t worker_count) {
+  const auto thread_count = worker_count > 0 ? worker_count : std::max(std::thread::hardware_concurrency(), 1u);
+  _workers.reserve(thread_count);
+  for (auto worker_id = uint32_t{0}; worker_id < thread_count; ++worker_id) {
+    _workers.emplace_back([&]() { _work(); });
+  }
+}
+
+TaskQueueScheduler::~TaskQueueScheduler() { finish(); }
+
+void TaskQueueScheduler::enqueue(std::shared_ptr<AbstractTask> task) {
+  {
+    std::lock_guard lock(_queue_mutex);
+    _queue.push_back(std::move(task));
+  }
+  _queue_condition.notify_one();
+}
+
+void TaskQueueScheduler::wait_for(const AbstractTask& task) {
+  while (!task.is_done()) {
+    auto next_task = std::shared_ptr<AbstractTask>{};
+    {
+      std::unique_lock lock(_queue_mutex);
+      if (_queue.empty()) {
+        // Tasks do not notify the queue when they are done, so we only wait for a short time
+        _queue_condition.wait_for(lock, std::chrono::microseconds(100));
+        continue;
+      }
+      next_task = std::move(_queue.front());
+      _queue.pop_front();
+    }
+    next_task->execute();
+  }
+}
+
+void TaskQueueScheduler::finish() {
+  {
+    std::lock_guard lock(_queue_mutex);
+    if (_shutdown_requested) return;
+    _shutdown_requested = true;
+  }
+  _queue_condition.notify_all();
+
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+uint32_t TaskQueueScheduler::worker_count() const { return static_cast<uint32_t>(_workers.size()); }
+
+void TaskQueueScheduler::_work() {
+  while (true) {
+    auto task = std::shared_ptr<AbstractTask>{};
+    {
+      std::unique_lock lock(_queue_mutex);
+      _queue_condition.wait(lock, [&]() { return _shutdown_requested || !_queue.empty(); });
+      // Workers only stop once the queue is drained
+      if (_queue.empty()) return;
+      task = std::move(_queue.front());
+      _queue.pop_front();
+    }
+    task->execute();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+// Executes ready tasks in a fixed pool of worker threads that share a single FIFO queue.
+// Threads that wait for a task (including workers that wait for sub-tasks of their own task) take tasks from the
+// queue in the meantime, so nested parallelism does not exhaust the pool.
+class TaskQueueScheduler : private Noncopyable {
+ public:
+  // worker_count 0 creates one worker per hardware thread
+  explicit TaskQueueScheduler(const uint32_t worker_count = 0);
+  ~TaskQueueScheduler();
+
+  void enqueue(std::shared_ptr<AbstractTask> task);
+
+  // executes queued tasks in the calling thread until the given task is done
+  void wait_for(const AbstractTask& task);
+
+  // waits for all queued tasks and stops the workers. Called by the destructor.
+  void finish();
+
+  uint32_t worker_count() const;
+
+ protected:
+  void _work();
+
+  std::deque<std::shared_ptr<AbstractTask>> _queue;
+  std::mutex _queue_mutex;
+  std::condition_variable _queue_condition;
+  bool _shutdown_requested = false;
+  std::vector<std::thread> _workers;
+};
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -8,8 +9,31 @@
 
 namespace opossum {
 
+// Number of positions by which the bulk gathers of the segments (their materialize methods) prefetch ahead
+constexpr auto MATERIALIZE_PREFETCH_DISTANCE = size_t{16};
+
+// Calls gather(chunk_offset) for the chunk offsets of pos_list[begin, end) in order. Before that,
+// prefetch(chunk_offset) is called with the chunk offset MATERIALIZE_PREFETCH_DISTANCE positions ahead, so that the
+// random accesses of the gather overlap with each other. The loop is split so that prefetching needs no bounds check.
+template <typename Prefetch, typename Gather>
+void for_each_prefetched_position(const PosList& pos_list, const size_t begin, const size_t end,
+                                  const Prefetch& prefetch, const Gather& gather) {
+  const auto prefetch_end = std::max(begin, end > MATERIALIZE_PREFETCH_DISTANCE ? end - MATERIALIZE_PREFETCH_DISTANCE
+                                                                                 : size_t{0});
+  auto index = begin;
+  for (; index < prefetch_end; ++index) {
+    prefetch(pos_list[index + MATERIALIZE_PREFETCH_DISTANCE].chunk_offset);
+    gather(pos_list[index].chunk_offset);
+  }
+  for (; index < end; ++index) gather(pos_list[index].chunk_offset);
+}
+
 // BaseSegment is the abstract super class for all segment types,
 // e.g., ValueSegment, ReferenceSegment
+//
+// The data segments additionally offer a bulk gather, materialize(pos_list, begin, end, out), which writes the values
+// at the chunk offsets of pos_list[begin, end) to out. As the value type is a template parameter, it cannot be a
+// virtual method here; segment_materialize resolves the segment type once per chunk and calls it.
 class BaseSegment : private Noncopyable {
  public:
   BaseSegment() = default;
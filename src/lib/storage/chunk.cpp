@@ -3,6 +3,7 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -14,17 +15,85 @@
 
 namespace opossum {
 
-void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) { _segments.push_back(segment); }
+namespace {
+
+// Returns a pointer to the segment that also owns the memory resource the segment may have been allocated from
+std::shared_ptr<BaseSegment> tie_to_memory_resource(std::shared_ptr<BaseSegment> segment,
+                                                    std::shared_ptr<std::pmr::memory_resource> memory_resource) {
+  if (!memory_resource) return segment;
+
+  struct SegmentOwner {
+    // Declared before the segment so that it is destroyed after it
+    std::shared_ptr<std::pmr::memory_resource> memory_resource;
+    std::shared_ptr<BaseSegment> segment;
+  };
+  auto* const raw_segment = segment.get();
+  return std::shared_ptr<BaseSegment>(
+      std::make_shared<SegmentOwner>(SegmentOwner{std::move(memory_resource), std::move(segment)}), raw_segment);
+}
+
+}  // namespace
+
+Chunk::Chunk(std::shared_ptr<std::pmr::memory_resource> memory_resource)
+    : _memory_resource{std::move(memory_resource)} {}
+
+void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) {
+  _segments.push_back(tie_to_memory_resource(std::move(segment), _memory_resource));
+}
+
+void Chunk::add_segment(std::shared_ptr<BaseSegment> segment,
+                        std::shared_ptr<std::pmr::memory_resource> memory_resource) {
+  _segments.push_back(tie_to_memory_resource(std::move(segment), std::move(memory_resource)));
+}
+
+std::shared_ptr<Chunk> Chunk::copy_with_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment) const {
+  DebugAssert(segment->size() == size(), "The new segment must have as many rows as the chunk");
+  auto chunk = std::make_shared<Chunk>(_memory_resource);
+  chunk->_segments = _segments;
+  chunk->_segments.at(column_id) = tie_to_memory_resource(std::move(segment), _memory_resource);
+  chunk->_ordered_by = _ordered_by;
+  chunk->_is_mutable = _is_mutable;
+  chunk->_distinct_sketches = _distinct_sketches;
+  return chunk;
+}
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
   DebugAssert(values.size() == column_count(), "Column count of new row needs to match coloumn count of table");
+  DebugAssert(_is_mutable, "Cannot append to an immutable chunk");
   for (ColumnID column_id(0); column_id < column_count(); ++column_id) {
     _segments[column_id]->append(values[column_id]);
   }
+  _ordered_by.reset();
+  _distinct_sketches.clear();
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const { return _segments.at(column_id); }
 
+std::pmr::memory_resource* Chunk::memory_resource() const {
+  return _memory_resource ? _memory_resource.get() : std::pmr::get_default_resource();
+}
+
+std::optional<ColumnID> Chunk::ordered_by() const { return _ordered_by; }
+
+void Chunk::set_ordered_by(const ColumnID column_id) {
+  DebugAssert(column_id < column_count(), "Column does not exist");
+  _ordered_by = column_id;
+}
+
+bool Chunk::is_mutable() const { return _is_mutable; }
+
+void Chunk::set_immutable() { _is_mutable = false; }
+
+std::shared_ptr<const HyperLogLog> Chunk::distinct_sketch(const ColumnID column_id) const {
+  return static_cast<size_t>(column_id) < _distinct_sketches.size() ? _distinct_sketches[column_id] : nullptr;
+}
+
+void Chunk::set_distinct_sketch(const ColumnID column_id, std::shared_ptr<const HyperLogLog> sketch) {
+  DebugAssert(column_id < column_count(), "Column does not exist");
+  if (_distinct_sketches.size() < column_count()) _distinct_sketches.resize(column_count());
+  _distinct_sketches[column_id] = std::move(sketch);
+}
+
 uint16_t Chunk::column_count() const { return _segments.size(); }
 
 uint32_t Chunk::size() const {
@@ -1,10 +1,12 @@
 #pragma once
 
 // the linter wants this to be above everything else
+#include <memory_resource>
 #include <shared_mutex>
 
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -15,23 +17,37 @@ namespace opossum {
 
 class BaseIndex;
 class BaseSegment;
+class HyperLogLog;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The segments across all chunks constitute the column.
 //
 // Find more information about this in our wiki: https://github.com/hyrise/hyrise/wiki/chunk-concept
+//
+// A chunk may own a memory resource (usually a monotonic arena) from which its segments are allocated. Every segment
+// handed out by the chunk keeps that resource alive, so that a segment can still be read after the chunk has been
+// replaced, e.g., by an operator that forwards it. The memory is released at once when the chunk and the last of its
+// segments are gone.
 class Chunk : private Noncopyable {
  public:
   Chunk() = default;
+  explicit Chunk(std::shared_ptr<std::pmr::memory_resource> memory_resource);
 
   // we need to explicitly set the move constructor to default when
   // we overwrite the copy constructor
   Chunk(Chunk&&) = default;
   Chunk& operator=(Chunk&&) = default;
 
-  // adds a segment to the "right" of the chunk
+  // adds a segment to the "right" of the chunk. The segment keeps the memory resource of the chunk alive.
   void add_segment(std::shared_ptr<BaseSegment> segment);
 
+  // adds a segment that was allocated from another memory resource than that of the chunk, which it keeps alive
+  void add_segment(std::shared_ptr<BaseSegment> segment, std::shared_ptr<std::pmr::memory_resource> memory_resource);
+
+  // Returns a new chunk in which the segment of a column is replaced with one that holds the same rows, e.g., in
+  // another encoding. The other segments, the memory resource, and the metadata of this chunk are kept.
+  std::shared_ptr<Chunk> copy_with_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment) const;
+
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   uint16_t column_count() const;
 
@@ -45,9 +61,33 @@ class Chunk : private Noncopyable {
   // Returns the segment at a given position
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // returns the memory resource that segments of this chunk should be allocated from
+  std::pmr::memory_resource* memory_resource() const;
+
+  // Returns the column by which the rows of this chunk are sorted in ascending order, if any. Operators use this to
+  // skip sorting. Appending a row clears the flag.
+  std::optional<ColumnID> ordered_by() const;
+
+  // marks the chunk as sorted by the given column. The caller has to make sure that the rows actually are sorted.
+  void set_ordered_by(const ColumnID column_id);
+
+  // Returns whether rows may be appended to the chunk. Chunks are immutable once they have been compressed, even if
+  // some of their segments were left unencoded.
+  bool is_mutable() const;
+  void set_immutable();
+
+  // Returns the sketch of the distinct values of a column, if one was stored when the chunk was compressed. Appending a
+  // row clears all sketches.
+  std::shared_ptr<const HyperLogLog> distinct_sketch(const ColumnID column_id) const;
+  void set_distinct_sketch(const ColumnID column_id, std::shared_ptr<const HyperLogLog> sketch);
+
  protected:
   // Implementation goes here
+  std::shared_ptr<std::pmr::memory_resource> _memory_resource;
   std::vector<std::shared_ptr<BaseSegment>> _segments;
+  std::optional<ColumnID> _ordered_by;
+  bool _is_mutable = true;
+  std::vector<std::shared_ptr<const HyperLogLog>> _distinct_sketches;
 };
 
 }  // namespace opossum
@@ -0,0 +1,245 @@
+#include "dictionary_merge.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Merges sorted dictionaries without duplicates into merged and returns, for every dictionary, the new ValueIDs of its
+// entries. The dictionaries are merged k-way through a heap that holds the index of every dictionary that is not yet
+// exhausted, ordered by its current entry.
+template <typename T>
+std::vector<std::vector<ValueID>> merge_sorted_dictionaries(const std::vector<const pmr_vector<T>*>& dictionaries,
+                                                            pmr_vector<T>& merged) {
+  auto mappings = std::vector<std::vector<ValueID>>(dictionaries.size());
+  auto positions = std::vector<size_t>(dictionaries.size(), 0);
+  auto total_size = size_t{0};
+  for (auto dictionary_index = size_t{0}; dictionary_index < dictionaries.size(); ++dictionary_index) {
+    mappings[dictionary_index].resize(dictionaries[dictionary_index]->size());
+    total_size += dictionaries[dictionary_index]->size();
+  }
+  merged.reserve(total_size);
+
+  const auto current_value = [&](const size_t dictionary_index) -> const T& {
+    return (*dictionaries[dictionary_index])[positions[dictionary_index]];
+  };
+  const auto greater = [&](const size_t left, const size_t right) {
+    return current_value(right) < current_value(left);
+  };
+  auto heap = std::priority_queue<size_t, std::vector<size_t>, decltype(greater)>{greater};
+  for (auto dictionary_index = size_t{0}; dictionary_index < dictionaries.size(); ++dictionary_index) {
+    if (!dictionaries[dictionary_index]->empty()) heap.push(dictionary_index);
+  }
+
+  while (!heap.empty()) {
+    const auto dictionary_index = heap.top();
+    heap.pop();
+
+    const auto& value = current_value(dictionary_index);
+    if (merged.empty() || merged.back() < value) merged.push_back(value);
+    const auto new_value_id = ValueID{static_cast<ValueID::base_type>(merged.size() - 1)};
+    mappings[dictionary_index][positions[dictionary_index]] = new_value_id;
+
+    if (++positions[dictionary_index] < dictionaries[dictionary_index]->size()) heap.push(dictionary_index);
+  }
+  return mappings;
+}
+
+// Calls func with a value of the narrowest attribute vector type that can address a dictionary of the given size
+template <typename Functor>
+void resolve_attribute_type_for_size(const size_t dictionary_size, const Functor& func) {
+  if (dictionary_size <= std::numeric_limits<uint8_t>::max()) {
+    func(uint8_t{});
+  } else if (dictionary_size <= std::numeric_limits<uint16_t>::max()) {
+    func(uint16_t{});
+  } else {
+    func(uint32_t{});
+  }
+}
+
+// Writes the new ValueIDs of all rows of segment to value_ids, starting at begin
+template <typename T, typename AttributeType>
+void gather_value_ids(const DictionarySegment<T>& segment, const std::vector<ValueID>& mapping,
+                      pmr_vector<AttributeType>& value_ids, const size_t begin) {
+  resolve_attribute_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+    const auto& old_value_ids = attribute_vector.values();
+    for (auto chunk_offset = size_t{0}; chunk_offset < old_value_ids.size(); ++chunk_offset) {
+      value_ids[begin + chunk_offset] = static_cast<AttributeType>(mapping[old_value_ids[chunk_offset]]);
+    }
+  });
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> merge_delta(const DictionarySegment<T>& main, const ValueSegment<T>& delta,
+                                         std::pmr::memory_resource* memory_resource) {
+  const auto& delta_values = delta.values();
+  auto delta_dictionary = pmr_vector<T>(delta_values.cbegin(), delta_values.cend());
+  std::sort(delta_dictionary.begin(), delta_dictionary.end());
+  delta_dictionary.erase(std::unique(delta_dictionary.begin(), delta_dictionary.end()), delta_dictionary.end());
+
+  const auto dictionary = std::allocate_shared<pmr_vector<T>>(PolymorphicAllocator<T>{memory_resource});
+  const auto mappings = merge_sorted_dictionaries<T>({main.dictionary().get(), &delta_dictionary}, *dictionary);
+  const auto& delta_mapping = mappings[1];
+
+  const auto main_row_count = main.size();
+  auto attribute_vector = std::shared_ptr<BaseAttributeVector>{};
+  resolve_attribute_type_for_size(dictionary->size(), [&](auto attribute_type) {
+    using AttributeType = decltype(attribute_type);
+    auto value_ids = pmr_vector<AttributeType>(main_row_count + delta_values.size(), memory_resource);
+    gather_value_ids(main, mappings[0], value_ids, 0);
+
+    for (auto delta_offset = size_t{0}; delta_offset < delta_values.size(); ++delta_offset) {
+      const auto delta_value_id = std::lower_bound(delta_dictionary.cbegin(), delta_dictionary.cend(),
+                                                   delta_values[delta_offset]) -
+                                  delta_dictionary.cbegin();
+      value_ids[main_row_count + delta_offset] = static_cast<AttributeType>(delta_mapping[delta_value_id]);
+    }
+
+    attribute_vector = std::allocate_shared<FixedSizeAttributeVector<AttributeType>>(
+        PolymorphicAllocator<AttributeType>{memory_resource}, std::move(value_ids));
+  });
+
+  return std::make_shared<DictionarySegment<T>>(dictionary, attribute_vector);
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> merge_dictionaries(const std::vector<const DictionarySegment<T>*>& segments,
+                                                std::pmr::memory_resource* memory_resource) {
+  auto dictionaries = std::vector<const pmr_vector<T>*>{};
+  dictionaries.reserve(segments.size());
+  auto row_count = size_t{0};
+  for (const auto* segment : segments) {
+    dictionaries.push_back(segment->dictionary().get());
+    row_count += segment->size();
+  }
+
+  const auto dictionary = std::allocate_shared<pmr_vector<T>>(PolymorphicAllocator<T>{memory_resource});
+  const auto mappings = merge_sorted_dictionaries<T>(dictionaries, *dictionary);
+
+  auto attribute_vector = std::shared_ptr<BaseAttributeVector>{};
+  resolve_attribute_type_for_size(dictionary->size(), [&](auto attribute_type) {
+    using AttributeType = decltype(attribute_type);
+    auto value_ids = pmr_vector<AttributeType>(row_count, memory_resource);
+    auto begin = size_t{0};
+    for (auto segment_index = size_t{0}; segment_index < segments.size(); ++segment_index) {
+      gather_value_ids(*segments[segment_index], mappings[segment_index], value_ids, begin);
+      begin += segments[segment_index]->size();
+    }
+
+    attribute_vector = std::allocate_shared<FixedSizeAttributeVector<AttributeType>>(
+        PolymorphicAllocator<AttributeType>{memory_resource}, std::move(value_ids));
+  });
+
+  return std::make_shared<DictionarySegment<T>>(dictionary, attribute_vector);
+}
+
+template <typename T>
+std::vector<std::shared_ptr<BaseSegment>> share_dictionary(
+    const std::vector<const DictionarySegment<T>*>& segments, std::pmr::memory_resource* dictionary_memory_resource,
+    const std::vector<std::pmr::memory_resource*>& segment_memory_resources) {
+  auto dictionaries = std::vector<const pmr_vector<T>*>{};
+  dictionaries.reserve(segments.size());
+  for (const auto* segment : segments) dictionaries.push_back(segment->dictionary().get());
+
+  const auto dictionary = std::allocate_shared<pmr_vector<T>>(PolymorphicAllocator<T>{dictionary_memory_resource});
+  const auto mappings = merge_sorted_dictionaries<T>(dictionaries, *dictionary);
+
+  // The attribute vectors are independent of each other and gathered by one job per segment
+  auto shared_segments = std::vector<std::shared_ptr<BaseSegment>>(segments.size());
+  resolve_attribute_type_for_size(dictionary->size(), [&](auto attribute_type) {
+    using AttributeType = decltype(attribute_type);
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(segments.size());
+    for (auto segment_index = size_t{0}; segment_index < segments.size(); ++segment_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, segment_index]() {
+        auto* const memory_resource = segment_memory_resources[segment_index];
+        auto value_ids = pmr_vector<AttributeType>(segments[segment_index]->size(), memory_resource);
+        gather_value_ids(*segments[segment_index], mappings[segment_index], value_ids, 0);
+
+        const auto attribute_vector = std::allocate_shared<FixedSizeAttributeVector<AttributeType>>(
+            PolymorphicAllocator<AttributeType>{memory_resource}, std::move(value_ids));
+        shared_segments[segment_index] = std::make_shared<DictionarySegment<T>>(dictionary, attribute_vector);
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  });
+  return shared_segments;
+}
+
+}  // namespace
+
+std::shared_ptr<BaseSegment> merge_delta_segment(const BaseSegment& main, const BaseSegment& delta,
+                                                 const DataType data_type,
+                                                 std::pmr::memory_resource* memory_resource) {
+  auto merged_segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto* main_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(&main);
+    const auto* delta_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&delta);
+    Assert(main_segment && delta_segment, "Can only merge a ValueSegment into a DictionarySegment of the same type");
+    merged_segment = merge_delta(*main_segment, *delta_segment, memory_resource);
+  });
+  return merged_segment;
+}
+
+std::shared_ptr<BaseSegment> merge_dictionary_segments(const BaseSegment& first, const BaseSegment& second,
+                                                       const DataType data_type,
+                                                       std::pmr::memory_resource* memory_resource) {
+  return merge_dictionary_segments(std::vector<const BaseSegment*>{&first, &second}, data_type, memory_resource);
+}
+
+std::shared_ptr<BaseSegment> merge_dictionary_segments(const std::vector<const BaseSegment*>& segments,
+                                                       const DataType data_type,
+                                                       std::pmr::memory_resource* memory_resource) {
+  auto merged_segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    auto dictionary_segments = std::vector<const DictionarySegment<ColumnDataType>*>{};
+    dictionary_segments.reserve(segments.size());
+    for (const auto* segment : segments) {
+      const auto* dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(segment);
+      Assert(dictionary_segment, "Can only merge DictionarySegments of the same type");
+      dictionary_segments.push_back(dictionary_segment);
+    }
+    merged_segment = merge_dictionaries(dictionary_segments, memory_resource);
+  });
+  return merged_segment;
+}
+
+std::vector<std::shared_ptr<BaseSegment>> share_dictionary(
+    const std::vector<const BaseSegment*>& segments, const DataType data_type,
+    std::pmr::memory_resource* dictionary_memory_resource,
+    const std::vector<std::pmr::memory_resource*>& segment_memory_resources) {
+  Assert(segments.size() == segment_memory_resources.size(), "Need one memory resource per segment");
+
+  auto shared_segments = std::vector<std::shared_ptr<BaseSegment>>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    auto dictionary_segments = std::vector<const DictionarySegment<ColumnDataType>*>{};
+    dictionary_segments.reserve(segments.size());
+    for (const auto* segment : segments) {
+      const auto* dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(segment);
+      Assert(dictionary_segment, "Can only share the dictionary of DictionarySegments of the same type");
+      dictionary_segments.push_back(dictionary_segment);
+    }
+    shared_segments = share_dictionary(dictionary_segments, dictionary_memory_resource, segment_memory_resources);
+  });
+  return shared_segments;
+}
+
+}  // namespace opossum
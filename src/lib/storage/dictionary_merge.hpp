@@ -0,0 +1,46 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <memory_resource>
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// Appends the rows of delta (a ValueSegment) to those of main (a DictionarySegment) and returns the result as a new
+// DictionarySegment, which is allocated from memory_resource. Neither input is modified.
+//
+// Instead of building the dictionary from scratch, only the distinct values of the delta are sorted. They are merged
+// with the sorted main dictionary in linear time, which yields the mapping from the old to the new ValueIDs of both
+// sides. The attribute vector of main is then rewritten with a gather through its mapping, with the width that the
+// merged dictionary needs.
+std::shared_ptr<BaseSegment> merge_delta_segment(const BaseSegment& main, const BaseSegment& delta,
+                                                 const DataType data_type,
+                                                 std::pmr::memory_resource* memory_resource);
+
+// Concatenates the rows of DictionarySegments of the same type into a new DictionarySegment, e.g., to compact many
+// small chunks. Nothing is decompressed or sorted: the dictionaries are merged in O(d log n) for d dictionary entries
+// in n segments (linear for two segments), and the attribute vectors are gathered through the resulting mappings.
+std::shared_ptr<BaseSegment> merge_dictionary_segments(const BaseSegment& first, const BaseSegment& second,
+                                                       const DataType data_type,
+                                                       std::pmr::memory_resource* memory_resource);
+std::shared_ptr<BaseSegment> merge_dictionary_segments(const std::vector<const BaseSegment*>& segments,
+                                                       const DataType data_type,
+                                                       std::pmr::memory_resource* memory_resource);
+
+// Rewrites DictionarySegments of the same type so that all of them share one dictionary, the merge of their
+// dictionaries. ValueIDs then mean the same value in every returned segment. The rows and their order stay the same;
+// only the attribute vectors are gathered through the mappings of the merge. The shared dictionary is allocated from
+// dictionary_memory_resource, the attribute vector of segments[i] from segment_memory_resources[i].
+std::vector<std::shared_ptr<BaseSegment>> share_dictionary(
+    const std::vector<const BaseSegment*>& segments, const DataType data_type,
+    std::pmr::memory_resource* dictionary_memory_resource,
+    const std::vector<std::pmr::memory_resource*>& segment_memory_resources);
+
+}  // namespace opossum
@@ -1,15 +1,24 @@
 #pragma once
 
+// the linter wants this to be above everything else
+#include <string_view>
+
 #include <algorithm>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
 #include "base_segment.hpp"
 #include "fixed_size_attribute_vector.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_queue_scheduler.hpp"
+#include "string_heap_segment.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/performance_warning.hpp"
@@ -30,30 +39,35 @@ class DictionarySegment : public BaseSegment {
  public:
   /**
    * Creates a Dictionary segment from a given value segment.
+   * The dictionary and the attribute vector are allocated using the given allocator.
+   * String dictionaries can also be built from a StringHeapSegment.
+   *
+   * Segments of at least PARALLEL_ENCODING_ROW_COUNT rows are split into one row range per worker of the current
+   * scheduler, so that a single large segment does not compress on a single core (see _encode).
    */
-  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment) {
-    std::shared_ptr<ValueSegment<T>> value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
-
-    // create dictionary
-    _dictionary = std::make_shared<std::vector<T>>(value_segment->values());
-    std::sort(_dictionary->begin(), _dictionary->end());
-    // eliminates all but the first element from every consecutive group of equivalent elements
-    auto last = std::unique(_dictionary->begin(), _dictionary->end());
-    // the dictionary must be resized following the unique operation
-    _dictionary->erase(last, _dictionary->end());
-
-    // create Attribute Vector with the most fitting width
-    _attribute_vector = _create_fix_sized_attribute_vector(_dictionary->size(), value_segment->size());
-
-    // for each entry in the segment
-    for (ChunkOffset segment_column(0); segment_column < value_segment->size(); ++segment_column) {
-      // find corresponding dictionary value
-      const ValueID& dictionary_value_id = lower_bound(type_cast<T>((*value_segment)[segment_column]));
-      DebugAssert(dictionary_value_id != INVALID_VALUE_ID, "a dictionary value must be found for each attribute");
-      _attribute_vector->set(segment_column, dictionary_value_id);
+  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment,
+                             const PolymorphicAllocator<T>& alloc = {})
+      : _alloc{alloc} {
+    if constexpr (std::is_same_v<T, std::string>) {
+      if (const auto string_heap_segment = std::dynamic_pointer_cast<StringHeapSegment>(base_segment)) {
+        _compress_string_heap_segment(*string_heap_segment);
+        return;
+      }
     }
+
+    std::shared_ptr<ValueSegment<T>> value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+    Assert(value_segment, "DictionarySegment can only be built from a ValueSegment of the same type");
+    const auto& values = value_segment->values();
+    _encode<T>(values.size(), [&](const size_t chunk_offset) -> const T& { return values[chunk_offset]; });
   }
 
+  // Creates a Dictionary segment from an existing dictionary and value ids into it, e.g., when rows of another
+  // DictionarySegment are gathered. The dictionary may be shared with other segments and may contain values that are
+  // not referenced by any value id.
+  DictionarySegment(const std::shared_ptr<const pmr_vector<T>>& dictionary,
+                    const std::shared_ptr<BaseAttributeVector>& attribute_vector)
+      : _alloc{dictionary->get_allocator()}, _dictionary{dictionary}, _attribute_vector{attribute_vector} {}
+
   // SEMINAR INFORMATION: Since most of these methods depend on the template parameter, you will have to implement
   // the DictionarySegment in this file. Replace the method signatures with actual implementations.
 
@@ -71,13 +85,25 @@ class DictionarySegment : public BaseSegment {
     return _dictionary->at(value_id);
   }
 
+  // writes the values at the chunk offsets of pos_list[begin, end) to out (see BaseSegment)
+  void materialize(const PosList& pos_list, const size_t begin, const size_t end, T* out) const {
+    switch (_attribute_vector->width()) {
+      case sizeof(uint8_t):
+        return _materialize<uint8_t>(pos_list, begin, end, out);
+      case sizeof(uint16_t):
+        return _materialize<uint16_t>(pos_list, begin, end, out);
+      default:
+        return _materialize<uint32_t>(pos_list, begin, end, out);
+    }
+  }
+
   // dictionary segments are immutable
   void append(const AllTypeVariant&) override {
     throw std::runtime_error("Tried to append but Dictionary Segments are immutable");
   }
 
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() const { return _dictionary; }
+  std::shared_ptr<const pmr_vector<T>> dictionary() const { return _dictionary; }
 
   // returns an underlying data structure
   std::shared_ptr<const BaseAttributeVector> attribute_vector() const { return _attribute_vector; }
@@ -87,7 +113,7 @@ class DictionarySegment : public BaseSegment {
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
-  ValueID lower_bound(T value) const {
+  ValueID lower_bound(const T& value) const {
     auto lower_bound_it = std::lower_bound(_dictionary->begin(), _dictionary->end(), value);
     if (lower_bound_it == _dictionary->end()) {
       return INVALID_VALUE_ID;
@@ -100,7 +126,7 @@ class DictionarySegment : public BaseSegment {
 
   // returns the first value ID that refers to a value > the search value
   // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
-  ValueID upper_bound(T value) const {
+  ValueID upper_bound(const T& value) const {
     auto upper_bound_it = std::upper_bound(_dictionary->begin(), _dictionary->end(), value);
     if (upper_bound_it == _dictionary->end()) {
       return INVALID_VALUE_ID;
@@ -111,6 +137,9 @@ class DictionarySegment : public BaseSegment {
   // same as upper_bound(T), but accepts an AllTypeVariant
   ValueID upper_bound(const AllTypeVariant& value) const { return upper_bound(type_cast<T>(value)); }
 
+  // Below this number of rows, a segment is encoded by the calling thread only
+  static constexpr auto PARALLEL_ENCODING_ROW_COUNT = size_t{1} << 18;
+
   // return the number of unique_values (dictionary entries)
   size_t unique_values_count() const { return _dictionary->size(); }
 
@@ -123,18 +152,109 @@ class DictionarySegment : public BaseSegment {
   }
 
  protected:
-  std::shared_ptr<std::vector<T>> _dictionary;
+  PolymorphicAllocator<T> _alloc;
+  std::shared_ptr<const pmr_vector<T>> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
 
  private:
+  template <typename AttributeType>
+  void _materialize(const PosList& pos_list, const size_t begin, const size_t end, T* out) const {
+    const auto& dictionary = *_dictionary;
+    const auto& value_ids = static_cast<const FixedSizeAttributeVector<AttributeType>&>(*_attribute_vector).values();
+    for_each_prefetched_position(
+        pos_list, begin, end, [&](const ChunkOffset chunk_offset) { __builtin_prefetch(&value_ids[chunk_offset]); },
+        [&](const ChunkOffset chunk_offset) { *out++ = dictionary[value_ids[chunk_offset]]; });
+  }
+
+  // Builds the dictionary on views into the heap of the string segment, so that every distinct string is copied once
+  void _compress_string_heap_segment(const StringHeapSegment& string_heap_segment) {
+    _encode<std::string_view>(string_heap_segment.size(), [&](const size_t chunk_offset) {
+      return string_heap_segment.get(static_cast<ChunkOffset>(chunk_offset));
+    });
+  }
+
+  // Builds the dictionary and the attribute vector from row_count values, where value_at(chunk_offset) returns the
+  // value of a row as a SortType. The rows are split into ranges:
+  //  1. Every range is sorted and deduplicated into a run by its own job.
+  //  2. The runs are merged pairwise (std::set_union keeps the values distinct), all merges of a round in parallel.
+  //  3. Every range looks up the value ids of its rows by binary search. The ranges write disjoint parts of the
+  //     attribute vector.
+  // The dictionary is sorted in temporary vectors so that only its final size is taken from the allocator.
+  template <typename SortType, typename ValueAt>
+  void _encode(const size_t row_count, const ValueAt& value_at) {
+    const auto scheduler = CurrentScheduler::get();
+    const auto range_count =
+        size_t{scheduler && row_count >= PARALLEL_ENCODING_ROW_COUNT ? scheduler->worker_count() : 1};
+    const auto range_begin = [&](const size_t range_index) { return range_index * row_count / range_count; };
+
+    auto runs = std::vector<std::vector<SortType>>(range_count);
+    _run_jobs(range_count, [&](const size_t range_index) {
+      auto& run = runs[range_index];
+      const auto end = range_begin(range_index + 1);
+      run.reserve(end - range_begin(range_index));
+      for (auto chunk_offset = range_begin(range_index); chunk_offset < end; ++chunk_offset) {
+        run.emplace_back(value_at(chunk_offset));
+      }
+      std::sort(run.begin(), run.end());
+      // eliminates all but the first element from every consecutive group of equivalent elements
+      run.erase(std::unique(run.begin(), run.end()), run.end());
+    });
+
+    while (runs.size() > 1) {
+      auto merged_runs = std::vector<std::vector<SortType>>((runs.size() + 1) / 2);
+      _run_jobs(merged_runs.size(), [&](const size_t merged_index) {
+        auto& left = runs[2 * merged_index];
+        if (2 * merged_index + 1 == runs.size()) {
+          merged_runs[merged_index] = std::move(left);
+          return;
+        }
+        const auto& right = runs[2 * merged_index + 1];
+        auto& merged = merged_runs[merged_index];
+        merged.reserve(left.size() + right.size());
+        std::set_union(left.cbegin(), left.cend(), right.cbegin(), right.cend(), std::back_inserter(merged));
+      });
+      runs = std::move(merged_runs);
+    }
+    const auto& distinct_values = runs.front();
+
+    _dictionary = std::allocate_shared<pmr_vector<T>>(_alloc, distinct_values.cbegin(), distinct_values.cend());
+
+    // create Attribute Vector with the most fitting width
+    _attribute_vector = _create_fix_sized_attribute_vector(distinct_values.size(), row_count);
+
+    _run_jobs(range_count, [&](const size_t range_index) {
+      const auto end = range_begin(range_index + 1);
+      for (auto chunk_offset = range_begin(range_index); chunk_offset < end; ++chunk_offset) {
+        const auto it = std::lower_bound(distinct_values.cbegin(), distinct_values.cend(), value_at(chunk_offset));
+        DebugAssert(it != distinct_values.cend() && *it == value_at(chunk_offset),
+                    "a dictionary value must be found for each attribute");
+        _attribute_vector->set(static_cast<ChunkOffset>(chunk_offset),
+                               ValueID(std::distance(distinct_values.cbegin(), it)));
+      }
+    });
+  }
+
+  // Calls func(index) for every index in [0, job_count), in parallel if there is a scheduler
+  template <typename Functor>
+  static void _run_jobs(const size_t job_count, const Functor& func) {
+    if (job_count == 1) return func(0);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(job_count);
+    for (auto job_index = size_t{0}; job_index < job_count; ++job_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([&func, job_index]() { func(job_index); }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  }
+
   std::shared_ptr<BaseAttributeVector> _create_fix_sized_attribute_vector(const size_t dict_size,
                                                                           const size_t value_segment_size) {
     if (dict_size <= std::numeric_limits<uint8_t>::max()) {
-      return std::make_shared<FixedSizeAttributeVector<uint8_t>>(value_segment_size);
+      return std::allocate_shared<FixedSizeAttributeVector<uint8_t>>(_alloc, value_segment_size, _alloc);
     } else if (dict_size <= std::numeric_limits<uint16_t>::max()) {
-      return std::make_shared<FixedSizeAttributeVector<uint16_t>>(value_segment_size);
+      return std::allocate_shared<FixedSizeAttributeVector<uint16_t>>(_alloc, value_segment_size, _alloc);
     } else {
-      return std::make_shared<FixedSizeAttributeVector<uint32_t>>(value_segment_size);
+      return std::allocate_shared<FixedSizeAttributeVector<uint32_t>>(_alloc, value_segment_size, _alloc);
     }
   }
 };
@@ -0,0 +1,175 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/string_heap_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// std::string keeps short strings in place (small string optimization), longer ones take an extra allocation
+constexpr auto SSO_CAPACITY = size_t{15};
+
+// Fixed, so that the same data is always encoded in the same way
+constexpr auto SAMPLE_SEED = uint64_t{42};
+
+const char* encoding_name(const SegmentEncoding encoding) {
+  switch (encoding) {
+    case SegmentEncoding::Unencoded:
+      return "Unencoded";
+    case SegmentEncoding::Dictionary:
+      return "Dictionary";
+    case SegmentEncoding::StringHeap:
+      return "StringHeap";
+  }
+  Fail("Unknown encoding");
+  return nullptr;
+}
+
+size_t chunk_memory_usage(const Chunk& chunk) {
+  auto memory_usage = size_t{0};
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    memory_usage += chunk.get_segment(column_id)->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+}  // namespace
+
+EncodingAdvisor::EncodingAdvisor(std::ostream* log) : _log{log} {}
+
+EncodingSpec EncodingAdvisor::advise(const Table& table, const ChunkID chunk_id) const {
+  const auto chunk_snapshot = table.get_chunk_snapshot(chunk_id);
+  const auto& chunk = *chunk_snapshot;
+
+  auto encoding_spec = EncodingSpec{};
+  encoding_spec.reserve(chunk.column_count());
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto data_type = table.column_data_type(column_id);
+    const auto statistics = estimate_statistics(*chunk.get_segment(column_id), data_type);
+    const auto estimates = estimate_encodings(statistics, data_type);
+
+    const auto cheapest = std::min_element(estimates.cbegin(), estimates.cend(), [](const auto& lhs, const auto& rhs) {
+      return lhs.size + lhs.scan_bytes < rhs.size + rhs.scan_bytes;
+    });
+    encoding_spec.push_back(cheapest->encoding);
+
+    if (_log) {
+      *_log << "Chunk " << chunk_id << ", column " << table.column_name(column_id) << ": "
+            << encoding_name(cheapest->encoding) << " (~" << statistics.estimated_distinct_count << " distinct of "
+            << statistics.row_count << " rows, estimated " << cheapest->size << " bytes)" << std::endl;
+    }
+  }
+  return encoding_spec;
+}
+
+void EncodingAdvisor::compress_chunk(Table& table, const ChunkID chunk_id) const {
+  const auto encoding_spec = advise(table, chunk_id);
+
+  const auto bytes_before = chunk_memory_usage(*table.get_chunk_snapshot(chunk_id));
+  table.compress_chunk(chunk_id, encoding_spec);
+  const auto bytes_after = chunk_memory_usage(*table.get_chunk_snapshot(chunk_id));
+
+  if (_log) {
+    *_log << "Chunk " << chunk_id << ": " << bytes_before << " -> " << bytes_after << " bytes, saved "
+          << static_cast<int64_t>(bytes_before) - static_cast<int64_t>(bytes_after) << " bytes" << std::endl;
+  }
+}
+
+SegmentEncodingStatistics EncodingAdvisor::estimate_statistics(const BaseSegment& segment, const DataType data_type) {
+  auto statistics = SegmentEncodingStatistics{segment.size(), 0, 0, 0.0};
+  if (statistics.row_count == 0) return statistics;
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto* value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment);
+    Assert(value_segment, "Can only advise encodings for ValueSegments");
+    const auto& values = value_segment->values();
+
+    // Rows are drawn at random (without replacement) rather than at a fixed stride, which could align with periodic
+    // data
+    auto sample = std::vector<ColumnDataType>{};
+    sample.reserve(std::min(values.size(), SAMPLE_SIZE));
+    auto random_engine = std::mt19937_64{SAMPLE_SEED};
+    std::sample(values.cbegin(), values.cend(), std::back_inserter(sample), SAMPLE_SIZE, random_engine);
+    statistics.sample_size = sample.size();
+
+    if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+      auto total_length = size_t{0};
+      for (const auto& value : sample) total_length += value.size();
+      statistics.average_string_length = static_cast<double>(total_length) / static_cast<double>(sample.size());
+    }
+
+    // GEE: the values seen once (f1) stand for sqrt(N / n) values each, the others are assumed to be complete
+    std::sort(sample.begin(), sample.end());
+    auto distinct_in_sample = size_t{0};
+    auto singletons = size_t{0};
+    for (auto begin = size_t{0}; begin < sample.size();) {
+      auto end = begin + 1;
+      while (end < sample.size() && sample[end] == sample[begin]) ++end;
+      ++distinct_in_sample;
+      if (end - begin == 1) ++singletons;
+      begin = end;
+    }
+    // GEE underestimates unique columns, which are common (keys) and are recognized by having no duplicates at all
+    if (singletons == sample.size()) {
+      statistics.estimated_distinct_count = statistics.row_count;
+      return;
+    }
+
+    const auto scale = std::sqrt(static_cast<double>(statistics.row_count) / static_cast<double>(sample.size()));
+    const auto estimate =
+        scale * static_cast<double>(singletons) + static_cast<double>(distinct_in_sample - singletons);
+    statistics.estimated_distinct_count =
+        std::clamp(static_cast<size_t>(std::llround(estimate)), distinct_in_sample, statistics.row_count);
+  });
+  return statistics;
+}
+
+std::vector<EncodingEstimate> EncodingAdvisor::estimate_encodings(const SegmentEncodingStatistics& statistics,
+                                                                  const DataType data_type) {
+  const auto row_count = statistics.row_count;
+  const auto distinct_count = statistics.estimated_distinct_count;
+  const auto is_string = data_type == DataType::String;
+  const auto string_length = static_cast<size_t>(std::ceil(statistics.average_string_length));
+
+  auto value_bytes = size_t{0};
+  resolve_data_type(data_type, [&](auto type) { value_bytes = sizeof(typename decltype(type)::type); });
+  if (is_string && string_length > SSO_CAPACITY) value_bytes += string_length + 1;
+
+  auto attribute_vector_width = sizeof(uint32_t);
+  if (distinct_count <= std::numeric_limits<uint8_t>::max()) {
+    attribute_vector_width = sizeof(uint8_t);
+  } else if (distinct_count <= std::numeric_limits<uint16_t>::max()) {
+    attribute_vector_width = sizeof(uint16_t);
+  }
+
+  auto estimates = std::vector<EncodingEstimate>{};
+  estimates.push_back({SegmentEncoding::Dictionary,
+                       row_count * attribute_vector_width + distinct_count * value_bytes,
+                       row_count * attribute_vector_width});
+  estimates.push_back({SegmentEncoding::Unencoded, row_count * value_bytes, row_count * value_bytes});
+
+  if (is_string) {
+    // With inline headers, most comparisons are decided by the header, and short strings do not use the heap at all
+    constexpr auto header_bytes = sizeof(StringHeapSegment::StringHeader);
+    const auto heap_bytes = string_length > StringHeapSegment::StringHeader::INLINE_LENGTH ? string_length : 0;
+    estimates.push_back(
+        {SegmentEncoding::StringHeap, row_count * (header_bytes + heap_bytes), row_count * header_bytes});
+  }
+  return estimates;
+}
+
+}  // namespace opossum
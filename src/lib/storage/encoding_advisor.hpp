@@ -0,0 +1,67 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Table;
+
+// The properties of a segment that decide how well it can be encoded, estimated from a sample of its rows
+struct SegmentEncodingStatistics {
+  size_t row_count;
+  size_t sample_size;
+  size_t estimated_distinct_count;
+  // Only set for strings
+  double average_string_length;
+};
+
+// The predicted size of a segment in an encoding and the number of bytes that a full scan of it reads
+struct EncodingEstimate {
+  SegmentEncoding encoding;
+  size_t size;
+  size_t scan_bytes;
+};
+
+/**
+ * Chooses the encoding of every segment of a chunk instead of always using dictionary encoding, which, e.g., doubles
+ * the size of a column of unique integers.
+ *
+ * A segment is sampled at SAMPLE_SIZE random rows. The number of distinct values is extrapolated from the sample with
+ * the GEE estimator (Charikar et al., "Towards Estimation Error Guarantees for Distinct Values"), which scales up the
+ * values that were seen only once. A sample without any duplicates is taken as a unique column. From the distinct
+ * count and the average string length, the size of the segment and the bytes read by a scan are predicted for every
+ * encoding that is available for its type. The encoding with the smallest sum of both wins, so that memory and scan
+ * speed count equally. On a tie, dictionary encoding is chosen, as several operators have fast paths for it.
+ *
+ * Run counts, value ranges, and sortedness are not considered, as none of the encodings in this tree exploits them.
+ */
+class EncodingAdvisor {
+ public:
+  static constexpr auto SAMPLE_SIZE = size_t{4'096};
+
+  // If log is given, compress_chunk writes the decisions and the bytes saved to it
+  explicit EncodingAdvisor(std::ostream* log = nullptr);
+
+  // Returns the cheapest encoding for every column of a chunk of ValueSegments
+  EncodingSpec advise(const Table& table, const ChunkID chunk_id) const;
+
+  // Compresses a chunk with the advised encodings
+  void compress_chunk(Table& table, const ChunkID chunk_id) const;
+
+  static SegmentEncodingStatistics estimate_statistics(const BaseSegment& segment, const DataType data_type);
+
+  // Returns the estimates for all encodings that are available for the data type, with dictionary encoding first
+  static std::vector<EncodingEstimate> estimate_encodings(const SegmentEncodingStatistics& statistics,
+                                                          const DataType data_type);
+
+ protected:
+  std::ostream* _log;
+};
+
+}  // namespace opossum
@@ -1,16 +1,22 @@
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include "base_attribute_vector.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
 template <typename T>
 class FixedSizeAttributeVector : public BaseAttributeVector {
  public:
-  explicit FixedSizeAttributeVector(const size_t size) { _attribute_vector = std::vector<T>(size); }
+  explicit FixedSizeAttributeVector(const size_t size, const PolymorphicAllocator<T>& alloc = {})
+      : _attribute_vector(size, alloc) {}
+
+  // creates an attribute vector that takes over the given value ids, e.g., gathered from another attribute vector
+  explicit FixedSizeAttributeVector(pmr_vector<T>&& values) : _attribute_vector(std::move(values)) {}
 
   // returns the value id at a given position
   ValueID get(const size_t i) const override {
@@ -30,8 +36,11 @@ class FixedSizeAttributeVector : public BaseAttributeVector {
   // returns the width of biggest value id in bytes
   AttributeVectorWidth width() const override { return AttributeVectorWidth(sizeof(T)); }
 
+  // returns all value ids. This is the preferred way of reading many value ids, as it avoids a virtual call per id.
+  const pmr_vector<T>& values() const { return _attribute_vector; }
+
  private:
-  std::vector<T> _attribute_vector;
+  pmr_vector<T> _attribute_vector;
 };
 
 }  // namespace opossum
@@ -0,0 +1,91 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace opossum {
+
+void HyperLogLog::add_hash(const uint64_t hash) {
+  const auto register_index = hash >> (64 - PRECISION);
+  const auto remaining_bits = hash << PRECISION;
+  // position of the first set bit, limited to the number of remaining bits plus one
+  const auto rank =
+      static_cast<uint8_t>(remaining_bits == 0 ? 64 - PRECISION + 1 : __builtin_clzll(remaining_bits) + 1);
+  _registers[register_index] = std::max(_registers[register_index], rank);
+  _exact_count.reset();
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  for (auto register_index = size_t{0}; register_index < REGISTER_COUNT; ++register_index) {
+    _registers[register_index] = std::max(_registers[register_index], other._registers[register_index]);
+  }
+
+  // An empty sketch does not change the exact count of the other one
+  if (_exact_count == size_t{0}) {
+    _exact_count = other._exact_count;
+  } else if (other._exact_count != size_t{0}) {
+    _exact_count.reset();
+  }
+}
+
+size_t HyperLogLog::estimate() const {
+  if (_exact_count) return *_exact_count;
+
+  constexpr auto register_count = static_cast<double>(REGISTER_COUNT);
+  auto inverse_sum = 0.0;
+  auto empty_registers = size_t{0};
+  for (const auto value : _registers) {
+    inverse_sum += std::ldexp(1.0, -static_cast<int>(value));
+    if (value == 0) ++empty_registers;
+  }
+
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto raw_estimate = alpha * register_count * register_count / inverse_sum;
+  if (raw_estimate <= 2.5 * register_count && empty_registers > 0) {
+    return static_cast<size_t>(
+        std::llround(register_count * std::log(register_count / static_cast<double>(empty_registers))));
+  }
+  return static_cast<size_t>(std::llround(raw_estimate));
+}
+
+std::optional<size_t> HyperLogLog::exact_count() const { return _exact_count; }
+
+HyperLogLog HyperLogLog::from_segment(const BaseSegment& segment, const DataType data_type) {
+  auto sketch = HyperLogLog{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto* dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(&segment);
+    if (!dictionary_segment) {
+      segment_for_each<ColumnDataType>(segment, [&](const ChunkOffset, const auto& value) { sketch.add(value); });
+      return;
+    }
+
+    auto is_used = std::vector<bool>(dictionary_segment->unique_values_count());
+    resolve_attribute_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+      for (const auto value_id : attribute_vector.values()) is_used[value_id] = true;
+    });
+
+    const auto& dictionary = *dictionary_segment->dictionary();
+    auto used_count = size_t{0};
+    for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+      if (!is_used[value_id]) continue;
+      sketch.add(dictionary[value_id]);
+      ++used_count;
+    }
+    sketch._exact_count = used_count;
+  });
+  return sketch;
+}
+
+uint64_t HyperLogLog::mix_hash(uint64_t hash) {
+  hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+  hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+  return hash ^ (hash >> 31);
+}
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <type_traits>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * Sketch of the distinct values of a segment or column (Flajolet et al., "HyperLogLog: the analysis of a near-optimal
+ * cardinality estimation algorithm"). Every value is hashed to 64 bits. The first PRECISION bits select a register,
+ * which keeps the maximum position of the first set bit among the remaining bits. The registers of two sketches are
+ * merged by their maximum, so that the sketch of a table is the merge of the sketches of its chunks, regardless of
+ * how often a value occurs in them. With 2^12 registers of one byte, the standard error is about 1.6 %. Small
+ * cardinalities are estimated by linear counting over the empty registers.
+ *
+ * A sketch of a single DictionarySegment also knows the exact number of distinct values. Merging it with an empty
+ * sketch keeps the exact count, merging two non-empty sketches loses it.
+ */
+class HyperLogLog {
+ public:
+  static constexpr auto PRECISION = size_t{12};
+  static constexpr auto REGISTER_COUNT = size_t{1} << PRECISION;
+
+  // adds a value by its hash, which should be spread over all 64 bits
+  void add_hash(uint64_t hash);
+
+  // adds a value. Integers are hashed to themselves by std::hash, so its result is mixed once more.
+  template <typename T>
+  void add(const T& value) {
+    if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+      add_hash(mix_hash(std::hash<std::string_view>{}(value)));
+    } else {
+      add_hash(mix_hash(std::hash<T>{}(value)));
+    }
+  }
+
+  // adds the values of another sketch, so that this sketch describes the union of both
+  void merge(const HyperLogLog& other);
+
+  // returns the estimated number of distinct values, or the exact number if it is known
+  size_t estimate() const;
+
+  // returns the exact number of distinct values, if known
+  std::optional<size_t> exact_count() const;
+
+  // Creates the sketch of a data segment. For a DictionarySegment, only its dictionary is hashed. The used ValueIDs
+  // are counted, as a shared dictionary may hold values that do not occur in the segment (see
+  // Table::share_dictionaries).
+  static HyperLogLog from_segment(const BaseSegment& segment, const DataType data_type);
+
+  // the finalizer of SplitMix64
+  static uint64_t mix_hash(uint64_t hash);
+
+ protected:
+  std::array<uint8_t, REGISTER_COUNT> _registers{};
+  // An empty sketch knows that it has no values
+  std::optional<size_t> _exact_count{0};
+};
+
+}  // namespace opossum
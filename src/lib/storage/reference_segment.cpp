@@ -0,0 +1,43 @@
+#include "reference_segment.hpp"
+
+#include <memory>
+#include <string>
+
+#include "table.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced_table,
+                                   const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
+    : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {
+  DebugAssert(referenced_table->chunk_count() == 0 ||
+                  !std::dynamic_pointer_cast<ReferenceSegment>(
+                      referenced_table->get_chunk_snapshot(ChunkID{0})->get_segment(referenced_column_id)),
+              "ReferenceSegments must not reference other ReferenceSegments");
+}
+
+AllTypeVariant ReferenceSegment::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  const auto& row_id = (*_pos_list)[chunk_offset];
+  const auto referenced_chunk = _referenced_table->get_chunk_snapshot(row_id.chunk_id);
+  return (*referenced_chunk->get_segment(_referenced_column_id))[row_id.chunk_offset];
+}
+
+void ReferenceSegment::append(const AllTypeVariant&) { Fail("ReferenceSegment is immutable"); }
+
+size_t ReferenceSegment::size() const { return _pos_list->size(); }
+
+const std::shared_ptr<const PosList> ReferenceSegment::pos_list() const { return _pos_list; }
+
+const std::shared_ptr<const Table> ReferenceSegment::referenced_table() const { return _referenced_table; }
+
+ColumnID ReferenceSegment::referenced_column_id() const { return _referenced_column_id; }
+
+size_t ReferenceSegment::estimate_memory_usage() const {
+  // The position list may be shared with other segments, we count it nevertheless
+  return sizeof(*this) + _pos_list->size() * sizeof(RowID);
+}
+
+}  // namespace opossum
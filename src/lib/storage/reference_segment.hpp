@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// ReferenceSegment is a specific segment type that stores all its values as position list of a referenced column.
+// Operators such as joins use it to pass their result on without copying any values.
+// A ReferenceSegment never references another ReferenceSegment, i.e., positions always point into a data table.
+class ReferenceSegment : public BaseSegment {
+ public:
+  // creates a reference segment
+  // the parameters specify the positions and the referenced column
+  ReferenceSegment(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
+                   const std::shared_ptr<const PosList> pos);
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  void append(const AllTypeVariant&) override;
+
+  size_t size() const override;
+
+  const std::shared_ptr<const PosList> pos_list() const;
+  const std::shared_ptr<const Table> referenced_table() const;
+  ColumnID referenced_column_id() const;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
+};
+
+}  // namespace opossum
@@ -0,0 +1,171 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "table.hpp"
+
+namespace opossum {
+
+// The type in which operators read values of type T. Strings are passed as views into the segment (or into its
+// dictionary) so that reading them does not copy. The views stay valid as long as the segment is alive.
+template <typename T>
+using SegmentValue = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+// Returns the value at a given position of a data segment (i.e., not a ReferenceSegment). Prefer segment_for_each
+// when reading all values.
+template <typename T, typename Segment>
+SegmentValue<T> segment_value(const Segment& segment, const ChunkOffset chunk_offset) {
+  if constexpr (std::is_same_v<Segment, ValueSegment<T>>) {
+    return segment.values()[chunk_offset];
+  } else if constexpr (std::is_same_v<Segment, DictionarySegment<T>>) {  // NOLINT
+    const auto& dictionary = *segment.dictionary();
+    return dictionary[segment.attribute_vector()->get(chunk_offset)];
+  } else {
+    static_assert(std::is_same_v<Segment, StringHeapSegment>, "Unknown segment type");
+    return segment.get(chunk_offset);
+  }
+}
+
+/**
+ * Calls func(chunk_offset, value) for every row of a segment of type T, with value being a SegmentValue<T>.
+ * The segment type is resolved once per segment, so func is instantiated for every segment type and the loops are
+ * not interrupted by virtual calls.
+ *
+ * For ReferenceSegments, the referenced values are visited in the order of the position list and chunk_offset is
+ * the position within the ReferenceSegment. The referenced segment is resolved once per run of positions that point
+ * into the same chunk.
+ */
+template <typename T, typename Functor>
+void segment_for_each(const BaseSegment& segment, const Functor& func) {
+  if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    const auto& pos_list = *reference_segment->pos_list();
+    const auto& referenced_table = *reference_segment->referenced_table();
+    const auto referenced_column_id = reference_segment->referenced_column_id();
+
+    auto run_begin = ChunkOffset{0};
+    while (run_begin < pos_list.size()) {
+      const auto chunk_id = pos_list[run_begin].chunk_id;
+      auto run_end = run_begin + 1;
+      while (run_end < pos_list.size() && pos_list[run_end].chunk_id == chunk_id) ++run_end;
+
+      const auto referenced_segment_ptr =
+          referenced_table.get_chunk_snapshot(chunk_id)->get_segment(referenced_column_id);
+      const auto& referenced_segment = *referenced_segment_ptr;
+      resolve_segment_type<T>(referenced_segment, [&](const auto& typed_segment) {
+        for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+          func(chunk_offset, segment_value<T>(typed_segment, pos_list[chunk_offset].chunk_offset));
+        }
+      });
+      run_begin = run_end;
+    }
+    return;
+  }
+
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+      const auto& values = typed_segment.values();
+      const auto row_count = static_cast<ChunkOffset>(values.size());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        func(chunk_offset, SegmentValue<T>{values[chunk_offset]});
+      }
+    } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {  // NOLINT
+      const auto& dictionary = *typed_segment.dictionary();
+      resolve_attribute_vector_type(*typed_segment.attribute_vector(), [&](const auto& attribute_vector) {
+        const auto& value_ids = attribute_vector.values();
+        const auto row_count = static_cast<ChunkOffset>(value_ids.size());
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+          func(chunk_offset, SegmentValue<T>{dictionary[value_ids[chunk_offset]]});
+        }
+      });
+    } else {
+      typed_segment.for_each(func);
+    }
+  });
+}
+
+/**
+ * Writes the values of all rows of a segment of type T to out, which needs to have room for segment.size() values.
+ *
+ * For ReferenceSegments, the values are gathered with the bulk gathers of the referenced segments. Every referenced
+ * segment is resolved once per chunk: if the position list consists of few runs of positions in the same chunk (e.g.,
+ * the output of a scan), the runs are gathered one by one. Otherwise (e.g., the output of a hash join), the positions
+ * are first grouped by their ChunkID with a counting sort, gathered chunk by chunk, and finally scattered to out.
+ */
+template <typename T>
+void segment_materialize(const BaseSegment& segment, T* out) {
+  const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment);
+  if (!reference_segment) {
+    segment_for_each<T>(segment,
+                        [&](const ChunkOffset chunk_offset, const auto& value) { out[chunk_offset] = T{value}; });
+    return;
+  }
+
+  const auto& pos_list = *reference_segment->pos_list();
+  const auto& referenced_table = *reference_segment->referenced_table();
+  const auto referenced_column_id = reference_segment->referenced_column_id();
+  const auto chunk_count = static_cast<size_t>(referenced_table.chunk_count());
+  const auto gather = [&](const ChunkID chunk_id, const PosList& positions, const size_t begin, const size_t end,
+                          T* chunk_out) {
+    const auto referenced_segment_ptr =
+        referenced_table.get_chunk_snapshot(chunk_id)->get_segment(referenced_column_id);
+    const auto& referenced_segment = *referenced_segment_ptr;
+    resolve_segment_type<T>(referenced_segment, [&](const auto& typed_segment) {
+      typed_segment.materialize(positions, begin, end, chunk_out);
+    });
+  };
+
+  auto run_count = size_t{0};
+  for (auto index = size_t{0}; index < pos_list.size(); ++index) {
+    if (index == 0 || pos_list[index].chunk_id != pos_list[index - 1].chunk_id) ++run_count;
+  }
+
+  if (run_count <= chunk_count) {
+    auto run_begin = size_t{0};
+    while (run_begin < pos_list.size()) {
+      const auto chunk_id = pos_list[run_begin].chunk_id;
+      auto run_end = run_begin + 1;
+      while (run_end < pos_list.size() && pos_list[run_end].chunk_id == chunk_id) ++run_end;
+      gather(chunk_id, pos_list, run_begin, run_end, out + run_begin);
+      run_begin = run_end;
+    }
+    return;
+  }
+
+  auto chunk_begins = std::vector<size_t>(chunk_count + 1);
+  for (const auto& row_id : pos_list) ++chunk_begins[row_id.chunk_id + 1];
+  for (auto chunk_id = size_t{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunk_begins[chunk_id + 1] += chunk_begins[chunk_id];
+  }
+
+  auto grouped_pos_list = PosList(pos_list.size());
+  auto grouped_indices = std::vector<size_t>(pos_list.size());
+  auto next_slots = std::vector<size_t>(chunk_begins.begin(), chunk_begins.end() - 1);
+  for (auto index = size_t{0}; index < pos_list.size(); ++index) {
+    const auto slot = next_slots[pos_list[index].chunk_id]++;
+    grouped_pos_list[slot] = pos_list[index];
+    grouped_indices[slot] = index;
+  }
+
+  auto grouped_values = std::vector<T>(pos_list.size());
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto begin = chunk_begins[chunk_id];
+    const auto end = chunk_begins[chunk_id + 1];
+    if (begin < end) gather(chunk_id, grouped_pos_list, begin, end, grouped_values.data() + begin);
+  }
+  for (auto slot = size_t{0}; slot < grouped_values.size(); ++slot) {
+    out[grouped_indices[slot]] = std::move(grouped_values[slot]);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,216 @@
+#include "segment_scan.hpp"
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "resolve_type.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename Comparator, typename Values, typename T>
+void scan_values(const Values& values, const Comparator& comparator, const T& search_value, const ChunkID chunk_id,
+                 PosList& matches) {
+  const auto row_count = static_cast<ChunkOffset>(values.size());
+  for (ChunkOffset chunk_offset{0}; chunk_offset < row_count; ++chunk_offset) {
+    if (comparator(values[chunk_offset], search_value)) matches.push_back(RowID{chunk_id, chunk_offset});
+  }
+}
+
+void add_all_rows(const size_t row_count, const ChunkID chunk_id, PosList& matches) {
+  matches.reserve(matches.size() + row_count);
+  for (ChunkOffset chunk_offset{0}; chunk_offset < row_count; ++chunk_offset) {
+    matches.push_back(RowID{chunk_id, chunk_offset});
+  }
+}
+
+template <typename T, typename Comparator>
+void scan_typed_segment(const ValueSegment<T>& segment, const Comparator& comparator, const T& search_value,
+                        const ChunkID chunk_id, PosList& matches) {
+  scan_values(segment.values(), comparator, search_value, chunk_id, matches);
+}
+
+template <typename T, typename Comparator>
+void scan_typed_segment(const StringHeapSegment& segment, const Comparator& comparator, const T& search_value,
+                        const ChunkID chunk_id, PosList& matches) {
+  // compare() returns <0, 0 or >0, so applying the comparator to its result and 0 is equivalent to comparing values
+  segment.for_each([&](const auto chunk_offset, auto) {
+    if (comparator(segment.compare(chunk_offset, search_value), 0)) matches.push_back(RowID{chunk_id, chunk_offset});
+  });
+}
+
+template <typename T, typename Comparator>
+void scan_typed_segment(const DictionarySegment<T>& segment, const Comparator&, const T& search_value,
+                        const ChunkID chunk_id, PosList& matches) {
+  // Translate the predicate on values into a predicate on value ids. As bounds, INVALID_VALUE_ID means "after the
+  // last value id", which is the dictionary size.
+  const auto dictionary_size = ValueID{static_cast<ValueID::base_type>(segment.unique_values_count())};
+  const auto as_bound = [&](const ValueID value_id) {
+    return value_id == INVALID_VALUE_ID ? dictionary_size : value_id;
+  };
+  const auto lower_bound = as_bound(segment.lower_bound(search_value));
+  const auto upper_bound = as_bound(segment.upper_bound(search_value));
+  const auto search_value_found = lower_bound != upper_bound;
+
+  const auto scan_value_ids = [&](const auto& value_id_comparator, const ValueID value_id) {
+    resolve_attribute_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+      scan_values(attribute_vector.values(), value_id_comparator, static_cast<ValueID::base_type>(value_id), chunk_id,
+                  matches);
+    });
+  };
+
+  if constexpr (std::is_same_v<Comparator, std::equal_to<>>) {
+    if (search_value_found) scan_value_ids(std::equal_to<>{}, lower_bound);
+  }
+  if constexpr (std::is_same_v<Comparator, std::not_equal_to<>>) {
+    if (search_value_found) {
+      scan_value_ids(std::not_equal_to<>{}, lower_bound);
+    } else {
+      add_all_rows(segment.size(), chunk_id, matches);
+    }
+  }
+  if constexpr (std::is_same_v<Comparator, std::less<>>) {
+    if (lower_bound == dictionary_size) {
+      add_all_rows(segment.size(), chunk_id, matches);
+    } else if (lower_bound > 0) {
+      scan_value_ids(std::less<>{}, lower_bound);
+    }
+  }
+  if constexpr (std::is_same_v<Comparator, std::less_equal<>>) {
+    if (upper_bound == dictionary_size) {
+      add_all_rows(segment.size(), chunk_id, matches);
+    } else if (upper_bound > 0) {
+      scan_value_ids(std::less<>{}, upper_bound);
+    }
+  }
+  if constexpr (std::is_same_v<Comparator, std::greater<>>) {
+    if (upper_bound == 0) {
+      add_all_rows(segment.size(), chunk_id, matches);
+    } else if (upper_bound < dictionary_size) {
+      scan_value_ids(std::greater_equal<>{}, upper_bound);
+    }
+  }
+  if constexpr (std::is_same_v<Comparator, std::greater_equal<>>) {
+    if (lower_bound == 0) {
+      add_all_rows(segment.size(), chunk_id, matches);
+    } else if (lower_bound < dictionary_size) {
+      scan_value_ids(std::greater_equal<>{}, lower_bound);
+    }
+  }
+}
+
+// Returns the first chunk offset in [begin, end) for which predicate is false, given that it is true for all offsets
+// before and false for all offsets after that one
+template <typename Predicate>
+ChunkOffset partition_point(ChunkOffset begin, const ChunkOffset end, const Predicate& predicate) {
+  for (auto count = end - begin; count > 0;) {
+    const auto step = count / 2;
+    if (predicate(begin + step)) {
+      begin += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return begin;
+}
+
+// Returns the first row whose value is not less than the search value (lower bound) and the first row whose value is
+// greater than the search value (upper bound), given a function that compares the value of a row with the search value
+template <typename Compare>
+std::pair<ChunkOffset, ChunkOffset> sorted_bounds(const size_t row_count, const Compare& compare) {
+  const auto end = static_cast<ChunkOffset>(row_count);
+  const auto lower_bound = partition_point(ChunkOffset{0}, end, [&](const auto offset) { return compare(offset) < 0; });
+  const auto upper_bound = partition_point(lower_bound, end, [&](const auto offset) { return compare(offset) <= 0; });
+  return {lower_bound, upper_bound};
+}
+
+template <typename T>
+std::pair<ChunkOffset, ChunkOffset> sorted_typed_bounds(const ValueSegment<T>& segment, const T& search_value) {
+  const auto& values = segment.values();
+  return sorted_bounds(values.size(), [&](const ChunkOffset chunk_offset) {
+    return values[chunk_offset] < search_value ? -1 : (search_value < values[chunk_offset] ? 1 : 0);
+  });
+}
+
+template <typename T>
+std::pair<ChunkOffset, ChunkOffset> sorted_typed_bounds(const StringHeapSegment& segment, const T& search_value) {
+  return sorted_bounds(segment.size(),
+                       [&](const ChunkOffset chunk_offset) { return segment.compare(chunk_offset, search_value); });
+}
+
+template <typename T>
+std::pair<ChunkOffset, ChunkOffset> sorted_typed_bounds(const DictionarySegment<T>& segment, const T& search_value) {
+  // The bounds of the search value in the dictionary are the bounds of the rows in the attribute vector
+  const auto dictionary_size = ValueID{static_cast<ValueID::base_type>(segment.unique_values_count())};
+  const auto as_bound = [&](const ValueID value_id) {
+    return value_id == INVALID_VALUE_ID ? dictionary_size : value_id;
+  };
+  const auto lower_value_id = as_bound(segment.lower_bound(search_value));
+  const auto upper_value_id = as_bound(segment.upper_bound(search_value));
+
+  auto bounds = std::pair<ChunkOffset, ChunkOffset>{};
+  resolve_attribute_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+    const auto& value_ids = attribute_vector.values();
+    const auto end = static_cast<ChunkOffset>(value_ids.size());
+    const auto lower_bound = partition_point(ChunkOffset{0}, end, [&](const auto offset) {
+      return ValueID{value_ids[offset]} < lower_value_id;
+    });
+    const auto upper_bound = partition_point(lower_bound, end, [&](const auto offset) {
+      return ValueID{value_ids[offset]} < upper_value_id;
+    });
+    bounds = {lower_bound, upper_bound};
+  });
+  return bounds;
+}
+
+}  // namespace
+
+ChunkOffsetRange scan_sorted_segment(const BaseSegment& segment, const DataType data_type, const ScanType scan_type,
+                                     const AllTypeVariant& search_value) {
+  auto range = ChunkOffsetRange{ChunkOffset{0}, ChunkOffset{0}};
+  resolve_data_and_segment_type(segment, data_type, [&](auto type, const auto& typed_segment) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto [lower_bound, upper_bound] =  // NOLINT
+        sorted_typed_bounds<ColumnDataType>(typed_segment, type_cast<ColumnDataType>(search_value));
+    const auto row_count = static_cast<ChunkOffset>(typed_segment.size());
+
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        range = {lower_bound, upper_bound};
+        return;
+      case ScanType::OpLessThan:
+        range = {ChunkOffset{0}, lower_bound};
+        return;
+      case ScanType::OpLessThanEquals:
+        range = {ChunkOffset{0}, upper_bound};
+        return;
+      case ScanType::OpGreaterThan:
+        range = {upper_bound, row_count};
+        return;
+      case ScanType::OpGreaterThanEquals:
+        range = {lower_bound, row_count};
+        return;
+      case ScanType::OpNotEquals:
+        Fail("OpNotEquals does not match a single range of a sorted segment");
+    }
+  });
+  return range;
+}
+
+void scan_segment(const BaseSegment& segment, const DataType data_type, const ScanType scan_type,
+                  const AllTypeVariant& search_value, const ChunkID chunk_id, PosList& matches) {
+  resolve_data_and_segment_type(segment, data_type, [&](auto type, const auto& typed_segment) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto typed_search_value = type_cast<ColumnDataType>(search_value);
+
+    resolve_scan_type(scan_type, [&](const auto& comparator) {
+      scan_typed_segment<ColumnDataType>(typed_segment, comparator, typed_search_value, chunk_id, matches);
+    });
+  });
+}
+
+}  // namespace opossum
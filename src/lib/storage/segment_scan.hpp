@@ -0,0 +1,35 @@
+#pragma once
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// Appends the RowIDs of all rows of a segment whose value satisfies `value <scan_type> search_value` to matches.
+//
+// The data type, the segment type and the scan type are resolved once per call (i.e., once per chunk) into a fully
+// templated kernel, so that the loop over the rows neither contains virtual calls nor switches. Dictionary segments
+// are scanned on their value ids: the search value is translated into a value id bound once, and only the attribute
+// vector is read.
+void scan_segment(const BaseSegment& segment, const DataType data_type, const ScanType scan_type,
+                  const AllTypeVariant& search_value, const ChunkID chunk_id, PosList& matches);
+
+// The rows [begin, end) of a chunk. This is how the matches in a sorted segment are represented before they are
+// expanded into a PosList.
+struct ChunkOffsetRange {
+  ChunkOffset begin;
+  ChunkOffset end;
+
+  size_t size() const { return end - begin; }
+};
+
+// Returns the rows of a segment whose values are sorted in ascending order (see Chunk::ordered_by) that satisfy
+// `value <scan_type> search_value`. In a sorted segment, these rows are contiguous and are found with two binary
+// searches instead of a full scan: over the values for ValueSegments and StringHeapSegments, and over the ValueIDs in
+// the attribute vector for DictionarySegments. OpNotEquals does not yield a single range and is not supported.
+ChunkOffsetRange scan_sorted_segment(const BaseSegment& segment, const DataType data_type, const ScanType scan_type,
+                                     const AllTypeVariant& search_value);
+
+}  // namespace opossum
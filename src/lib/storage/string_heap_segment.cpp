@@ -0,0 +1,91 @@
+#include "string_heap_segment.hpp"
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <algorithm>
+#include <limits>
+#include <string>
+
+#include "type_cast.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+StringHeapSegment::StringHeapSegment(const bool use_inline_headers, const PolymorphicAllocator<char>& alloc)
+    : _use_inline_headers{use_inline_headers}, _offsets{alloc}, _headers{alloc}, _heap{alloc} {
+  if (!_use_inline_headers) _offsets.push_back(0);
+}
+
+AllTypeVariant StringHeapSegment::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  Assert(chunk_offset < size(), "Chunk offset out of range");
+  return std::string{get(chunk_offset)};
+}
+
+void StringHeapSegment::append(const AllTypeVariant& val) {
+  if (const auto* string = boost::get<std::string>(&val)) {
+    append_string(*string);
+  } else {
+    append_string(type_cast<std::string>(val));
+  }
+}
+
+void StringHeapSegment::append_string(std::string_view value) {
+  Assert(value.size() <= std::numeric_limits<uint32_t>::max() - _heap.size(), "StringHeapSegment heap is full");
+
+  if (!_use_inline_headers) {
+    _heap.insert(_heap.end(), value.cbegin(), value.cend());
+    _offsets.push_back(static_cast<uint32_t>(_heap.size()));
+    return;
+  }
+
+  auto header = StringHeader{static_cast<uint32_t>(value.size()), {}};
+  if (header.is_inlined()) {
+    std::copy(value.cbegin(), value.cend(), header.data);
+  } else {
+    std::copy_n(value.cbegin(), StringHeader::PREFIX_LENGTH, header.data);
+    const auto offset = static_cast<uint32_t>(_heap.size());
+    std::memcpy(header.data + StringHeader::PREFIX_LENGTH, &offset, sizeof(offset));
+    _heap.insert(_heap.end(), value.cbegin(), value.cend());
+  }
+  _headers.push_back(header);
+}
+
+void StringHeapSegment::materialize(const PosList& pos_list, const size_t begin, const size_t end,
+                                    std::string* out) const {
+  const auto gather = [&](const ChunkOffset chunk_offset) { *out++ = std::string{get(chunk_offset)}; };
+  if (_use_inline_headers) {
+    for_each_prefetched_position(
+        pos_list, begin, end, [&](const ChunkOffset chunk_offset) { __builtin_prefetch(&_headers[chunk_offset]); },
+        gather);
+  } else {
+    for_each_prefetched_position(
+        pos_list, begin, end, [&](const ChunkOffset chunk_offset) { __builtin_prefetch(&_offsets[chunk_offset]); },
+        gather);
+  }
+}
+
+int StringHeapSegment::compare(const ChunkOffset chunk_offset, std::string_view value) const {
+  if (_use_inline_headers) {
+    // Decide on the prefix if possible. Both sides are compared as unsigned chars, like std::char_traits<char> does.
+    const auto& header = _headers[chunk_offset];
+    const auto prefix_length =
+        std::min({static_cast<size_t>(header.length), value.size(), StringHeader::PREFIX_LENGTH});
+    const auto prefix_result = std::memcmp(header.data, value.data(), prefix_length);
+    if (prefix_result != 0) return prefix_result;
+  }
+
+  return get(chunk_offset).compare(value);
+}
+
+size_t StringHeapSegment::size() const { return _use_inline_headers ? _headers.size() : _offsets.size() - 1; }
+
+bool StringHeapSegment::uses_inline_headers() const { return _use_inline_headers; }
+
+size_t StringHeapSegment::estimate_memory_usage() const {
+  return _headers.size() * sizeof(StringHeader) + _offsets.size() * sizeof(uint32_t) + _heap.size();
+}
+
+}  // namespace opossum
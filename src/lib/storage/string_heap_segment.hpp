@@ -0,0 +1,105 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// StringHeapSegment is a value segment for strings that stores all characters in a single growable buffer (the
+// heap) instead of one std::string per row. Appending does not allocate per row and scans touch contiguous memory.
+//
+// Rows are located either through a plain offsets array into the heap (4 bytes per row) or through 12 byte inline
+// headers (German-string style): a header holds the length and the first four characters of a string, so that most
+// comparisons can be decided without touching the heap. Strings of up to eight characters are stored entirely in
+// the header and never reach the heap.
+class StringHeapSegment : public BaseSegment {
+ public:
+  struct StringHeader {
+    static constexpr size_t PREFIX_LENGTH = 4;
+    static constexpr size_t INLINE_LENGTH = 8;
+
+    uint32_t length;
+    // The first PREFIX_LENGTH characters hold the prefix. The remaining four bytes either hold the rest of an inlined
+    // string or the offset of the string in the heap.
+    char data[INLINE_LENGTH];
+
+    bool is_inlined() const { return length <= INLINE_LENGTH; }
+  };
+  static_assert(sizeof(StringHeader) == 12, "StringHeader is expected to take 12 bytes");
+
+  explicit StringHeapSegment(const bool use_inline_headers = true, const PolymorphicAllocator<char>& alloc = {});
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // add a value to the end
+  void append(const AllTypeVariant& val) final;
+
+  // add a string to the end without going through AllTypeVariant
+  void append_string(std::string_view value);
+
+  // returns a view of the string at a given position. The view is invalidated by subsequent appends.
+  std::string_view get(const ChunkOffset chunk_offset) const {
+    DebugAssert(chunk_offset < size(), "Chunk offset out of range");
+    if (!_use_inline_headers) {
+      const auto begin = _offsets[chunk_offset];
+      return std::string_view{_heap.data() + begin, _offsets[chunk_offset + 1] - begin};
+    }
+
+    const auto& header = _headers[chunk_offset];
+    if (header.is_inlined()) return std::string_view{header.data, header.length};
+    return std::string_view{_heap.data() + _heap_offset(header), header.length};
+  }
+
+  // calls func(chunk_offset, std::string_view) for every row. This is the preferred way of reading all values.
+  template <typename Functor>
+  void for_each(const Functor& func) const {
+    const auto row_count = static_cast<ChunkOffset>(size());
+    for (ChunkOffset chunk_offset{0}; chunk_offset < row_count; ++chunk_offset) {
+      func(chunk_offset, get(chunk_offset));
+    }
+  }
+
+  // writes the strings at the chunk offsets of pos_list[begin, end) to out (see BaseSegment)
+  void materialize(const PosList& pos_list, const size_t begin, const size_t end, std::string* out) const;
+
+  // compares the string at a given position with value (<0, 0, >0 as in std::string_view::compare). With inline
+  // headers, the heap is only accessed if the first characters are equal.
+  int compare(const ChunkOffset chunk_offset, std::string_view value) const;
+
+  // return the number of entries
+  size_t size() const final;
+
+  // returns whether rows are located through inline headers (true) or through an offsets array (false)
+  bool uses_inline_headers() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  static uint32_t _heap_offset(const StringHeader& header) {
+    uint32_t offset;
+    std::memcpy(&offset, header.data + StringHeader::PREFIX_LENGTH, sizeof(offset));
+    return offset;
+  }
+
+  const bool _use_inline_headers;
+
+  // Only one of them is used, depending on _use_inline_headers. _offsets holds size() + 1 entries.
+  pmr_vector<uint32_t> _offsets;
+  pmr_vector<StringHeader> _headers;
+
+  pmr_vector<char> _heap;
+};
+
+}  // namespace opossum
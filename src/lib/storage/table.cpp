@@ -8,51 +8,140 @@
 #include <numeric>
 #include <string>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "dictionary_merge.hpp"
 #include "dictionary_segment.hpp"
+#include "reference_segment.hpp"
+#include "segment_iterate.hpp"
+#include "string_heap_segment.hpp"
 #include "value_segment.hpp"
 
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-Table::Table(const uint32_t chunk_size) : _max_chunk_size{chunk_size} {
-  auto first_chunk = std::make_shared<Chunk>();
-  _chunks.push_back(first_chunk);
+namespace {
+
+// Creates a segment with the given encoding that holds the values of a ValueSegment
+std::shared_ptr<BaseSegment> encode_segment(const std::shared_ptr<BaseSegment>& segment, const DataType data_type,
+                                            const SegmentEncoding encoding,
+                                            std::pmr::memory_resource* memory_resource) {
+  auto encoded_segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment);
+    Assert(value_segment, "Can only encode ValueSegments");
+    const auto& values = value_segment->values();
+
+    switch (encoding) {
+      case SegmentEncoding::Unencoded:
+        encoded_segment = std::make_shared<ValueSegment<ColumnDataType>>(
+            pmr_vector<ColumnDataType>(values.cbegin(), values.cend(), memory_resource));
+        return;
+      case SegmentEncoding::Dictionary:
+        encoded_segment = std::make_shared<DictionarySegment<ColumnDataType>>(
+            segment, PolymorphicAllocator<ColumnDataType>{memory_resource});
+        return;
+      case SegmentEncoding::StringHeap:
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          auto string_heap_segment =
+              std::make_shared<StringHeapSegment>(true, PolymorphicAllocator<char>{memory_resource});
+          for (const auto& value : values) string_heap_segment->append_string(value);
+          encoded_segment = string_heap_segment;
+          return;
+        }
+        Fail("StringHeap encoding is only available for strings");
+    }
+  });
+  return encoded_segment;
+}
+
+// Appends the rows of a ValueSegment (delta) to those of a compressed segment (main), keeping the encoding of main
+std::shared_ptr<BaseSegment> append_to_segment(const BaseSegment& main, const BaseSegment& delta,
+                                               const DataType data_type, std::pmr::memory_resource* memory_resource) {
+  auto merged_segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto encoding = segment_encoding<ColumnDataType>(main);
+    if (encoding == SegmentEncoding::Dictionary) {
+      merged_segment = merge_delta_segment(main, delta, data_type, memory_resource);
+      return;
+    }
+
+    // Other encodings are cheap to build, so their rows are simply concatenated and encoded again
+    auto values = pmr_vector<ColumnDataType>{};
+    values.reserve(main.size() + delta.size());
+    const auto append_value = [&](const auto /* chunk_offset */, const auto& value) {
+      values.emplace_back(ColumnDataType{value});
+    };
+    segment_for_each<ColumnDataType>(main, append_value);
+    segment_for_each<ColumnDataType>(delta, append_value);
+    merged_segment = encode_segment(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)), data_type,
+                                    encoding, memory_resource);
+  });
+  return merged_segment;
+}
+
+}  // namespace
+
+Table::Table(const uint32_t chunk_size, std::pmr::memory_resource* memory_resource, const bool use_chunk_arenas,
+             const bool use_huge_pages)
+    : _max_chunk_size{chunk_size}, _memory_resource{memory_resource}, _use_chunk_arenas{use_chunk_arenas} {
+  if (use_huge_pages) {
+    _huge_page_resource =
+        std::make_shared<HugePageMemoryResource>(HugePageMemoryResource::HUGE_PAGE_SIZE, _memory_resource);
+  }
+  _chunks.push_back(_create_chunk());
 }
 
 void Table::add_column(const std::string& name, const std::string& type) {
   Assert(row_count() == 0, "Cannot add column to non-emtpy table");
+  const auto data_type = data_type_from_string(type);
   _column_names.push_back(name);
   _column_types.push_back(type);
+  _column_data_types.push_back(data_type);
 
   // add segment of the right type to every chunk
   for (auto& chunk : _chunks) {
-    auto segment = make_shared_by_data_type<BaseSegment, ValueSegment>(type);
+    auto segment = make_shared_by_data_type<BaseSegment, ValueSegment>(data_type, chunk->memory_resource());
     chunk->add_segment(segment);
   }
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
+  std::unique_lock write_lock(_chunk_access);
+
   // Add chunk with segments for every column if necessary
-  if (_chunks.back()->size() == _max_chunk_size) {
-    auto new_chunk = std::make_shared<Chunk>();
-    for (auto& type : _column_types) {
-      auto segment = make_shared_by_data_type<BaseSegment, ValueSegment>(type);
-      new_chunk->add_segment(segment);
-    }
-    _chunks.push_back(new_chunk);
+  if (_chunks.back()->size() == _max_chunk_size || !_is_mutable(*_chunks.back())) {
+    _chunks.push_back(_create_value_chunk());
   }
   _chunks.back()->append(values);
 }
 
+void Table::emplace_chunk(Chunk chunk) {
+  Assert(chunk.column_count() == column_count(), "Column count of new chunk needs to match column count of table");
+
+  std::unique_lock write_lock(_chunk_access);
+  if (_chunks.size() == 1 && _chunks.back()->size() == 0) {
+    _chunks.back() = std::make_shared<Chunk>(std::move(chunk));
+  } else {
+    _chunks.push_back(std::make_shared<Chunk>(std::move(chunk)));
+  }
+}
+
 uint16_t Table::column_count() const { return _column_names.size(); }
 
 uint64_t Table::row_count() const {
+  std::shared_lock read_lock(_chunk_access);
   uint64_t row_count = 0;
   for (auto& chunk : _chunks) {
     row_count += chunk->size();
@@ -60,7 +149,10 @@ uint64_t Table::row_count() const {
   return row_count;
 }
 
-ChunkID Table::chunk_count() const { return ChunkID(_chunks.size()); }
+ChunkID Table::chunk_count() const {
+  std::shared_lock read_lock(_chunk_access);
+  return ChunkID(_chunks.size());
+}
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   // Implementation goes here
@@ -86,45 +178,376 @@ const std::string& Table::column_type(ColumnID column_id) const {
   return _column_types[column_id];
 }
 
+DataType Table::column_data_type(ColumnID column_id) const {
+  DebugAssert(column_id < _column_data_types.size(), "No table with given ID");
+  return _column_data_types[column_id];
+}
+
 Chunk& Table::get_chunk(ChunkID chunk_id) {
-  DebugAssert(chunk_id < _chunks.size(), "No chunk with given ID");
   std::shared_lock read_lock(_chunk_access);
+  DebugAssert(chunk_id < _chunks.size(), "No chunk with given ID");
   return *_chunks[chunk_id];
 }
 
 const Chunk& Table::get_chunk(ChunkID chunk_id) const {
-  DebugAssert(chunk_id < _chunks.size(), "No chunk with given ID");
   std::shared_lock read_lock(_chunk_access);
+  DebugAssert(chunk_id < _chunks.size(), "No chunk with given ID");
   return *_chunks[chunk_id];
 }
 
+std::shared_ptr<const Chunk> Table::get_chunk_snapshot(ChunkID chunk_id) const {
+  std::shared_lock read_lock(_chunk_access);
+  DebugAssert(chunk_id < _chunks.size(), "No chunk with given ID");
+  return _chunks[chunk_id];
+}
+
+std::shared_ptr<const Table> Table::snapshot() const {
+  auto snapshot = std::make_shared<Table>(_max_chunk_size, _memory_resource, _use_chunk_arenas);
+  snapshot->_column_types = _column_types;
+  snapshot->_column_data_types = _column_data_types;
+  snapshot->_column_names = _column_names;
+  snapshot->_huge_page_resource = _huge_page_resource;
+
+  std::shared_lock read_lock(_chunk_access);
+  snapshot->_chunks = _chunks;
+
+  // Only the last chunk receives appends, all others are replaced rather than changed
+  const auto& last_chunk = *_chunks.back();
+  if (!_is_mutable(last_chunk)) return snapshot;
+
+  auto copied_chunk = snapshot->_create_chunk();
+  for (auto column_id = ColumnID{0}; column_id < last_chunk.column_count(); ++column_id) {
+    resolve_data_type(column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto value_segment =
+          std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(last_chunk.get_segment(column_id));
+      Assert(value_segment, "Rows can only be appended to ValueSegments");
+      const auto& values = value_segment->values();
+      copied_chunk->add_segment(std::make_shared<ValueSegment<ColumnDataType>>(
+          pmr_vector<ColumnDataType>(values.cbegin(), values.cend(), copied_chunk->memory_resource())));
+    });
+  }
+  if (last_chunk.ordered_by()) copied_chunk->set_ordered_by(*last_chunk.ordered_by());
+  snapshot->_chunks.back() = copied_chunk;
+  return snapshot;
+}
+
 void Table::compress_chunk(ChunkID chunk_id) {
-  auto& chunk = get_chunk(chunk_id);
+  compress_chunk(chunk_id, EncodingSpec(column_count(), SegmentEncoding::Dictionary));
+}
+
+void Table::compress_chunk(ChunkID chunk_id, const EncodingSpec& encoding_spec) {
+  // Serialized with merges of the delta and reorganizations, which replace chunks as well
+  std::lock_guard merge_lock(_merge_mutex);
+  auto chunk_ptr = std::shared_ptr<Chunk>{};
+  {
+    std::shared_lock read_lock(_chunk_access);
+    chunk_ptr = _chunks.at(chunk_id);
+  }
+  const auto& chunk = *chunk_ptr;
+  Assert(encoding_spec.size() == chunk.column_count(), "Need one encoding per column");
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    Assert(encoding_spec[column_id] != SegmentEncoding::StringHeap || column_data_type(column_id) == DataType::String,
+           "StringHeap encoding is only available for strings");
+  }
+
+  // The compressed segments get fresh arenas so that the arena of the value segments can be released as a whole.
+  // Arenas are not thread-safe, so every column is compressed into an arena of its own.
+  auto compressed_chunk = _create_chunk();
+  std::vector<std::shared_ptr<std::pmr::memory_resource>> memory_resources(chunk.column_count());
+  for (auto& memory_resource : memory_resources) memory_resource = _create_memory_resource();
 
   // create structures and lambda function
   std::vector<std::thread> threads;
   std::vector<std::shared_ptr<BaseSegment>> compressed_segments(chunk.column_count());
-  auto compress = [&compressed_segments](auto type, auto segment, auto segment_id) {
-    compressed_segments.at(segment_id) = make_shared_by_data_type<BaseSegment, DictionarySegment>(type, segment);
+  auto compress = [&compressed_segments, &memory_resources](auto data_type, auto encoding, auto segment,
+                                                            auto segment_id) {
+    compressed_segments.at(segment_id) =
+        encode_segment(segment, data_type, encoding, memory_resources.at(segment_id).get());
   };
 
   // start thread for each segment
-  for (size_t column_index = 0; column_index < chunk.size(); ++column_index) {
-    std::shared_ptr<BaseSegment> segment = chunk.get_segment(ColumnID(column_index));
-    std::string type = column_type(ColumnID(column_index));
-    threads.push_back(std::thread(compress, type, segment, column_index));
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+    std::shared_ptr<BaseSegment> segment = chunk.get_segment(column_id);
+    threads.push_back(
+        std::thread(compress, column_data_type(column_id), encoding_spec[column_id], segment, column_id));
   }
 
   // join threads and add segment to chunk
-  Chunk dictionary_chunk;
   for (size_t thread_id = 0; thread_id < threads.size(); ++thread_id) {
     threads[thread_id].join();
-    dictionary_chunk.add_segment(compressed_segments.at(thread_id));
+    compressed_chunk->add_segment(compressed_segments.at(thread_id), memory_resources.at(thread_id));
   }
 
-  // replace uncompressed chunk by compressed chunk
+  // Compression does not change the order of the rows
+  if (chunk.ordered_by()) compressed_chunk->set_ordered_by(*chunk.ordered_by());
+  compressed_chunk->set_immutable();
+  _add_distinct_sketches(*compressed_chunk);
+
+  // Replace the uncompressed chunk by the compressed chunk. Readers that still hold segments of the old chunk keep
+  // them, and the arena they were allocated from, alive.
   std::unique_lock write_lock(_chunk_access);
-  chunk = std::move(dictionary_chunk);
+  _chunks[chunk_id] = compressed_chunk;
+}
+
+void Table::merge_delta() {
+  std::lock_guard merge_lock(_merge_mutex);
+
+  // Freeze the delta, so that it can be read without locks. New rows go into a new delta from now on.
+  auto delta = std::shared_ptr<Chunk>{};
+  auto main = std::shared_ptr<Chunk>{};
+  {
+    std::unique_lock write_lock(_chunk_access);
+    const auto delta_iter = std::find_if(_chunks.cbegin(), _chunks.cend(), [&](const auto& chunk) {
+      return chunk->size() > 0 && _is_mutable(*chunk);
+    });
+    if (delta_iter == _chunks.cend()) return;
+    delta = *delta_iter;
+
+    // Skip the empty chunks that earlier merges left in place of their deltas
+    auto previous_iter = delta_iter;
+    while (previous_iter != _chunks.cbegin() && (*(previous_iter - 1))->size() == 0) --previous_iter;
+    if (previous_iter != _chunks.cbegin()) {
+      const auto& previous_chunk = *(previous_iter - 1);
+      if (!_is_mutable(*previous_chunk) && previous_chunk->size() + delta->size() <= _max_chunk_size) {
+        main = previous_chunk;
+      }
+    }
+    if (delta == _chunks.back()) _chunks.push_back(_create_value_chunk());
+  }
+
+  auto merged_chunk = _create_chunk();
+  auto* const memory_resource = merged_chunk->memory_resource();
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    const auto data_type = column_data_type(column_id);
+    if (main) {
+      merged_chunk->add_segment(
+          append_to_segment(*main->get_segment(column_id), *delta->get_segment(column_id), data_type, memory_resource));
+    } else {
+      merged_chunk->add_segment(make_shared_by_data_type<BaseSegment, DictionarySegment>(
+          data_type, delta->get_segment(column_id), memory_resource));
+    }
+  }
+  if (!main && delta->ordered_by()) merged_chunk->set_ordered_by(*delta->ordered_by());
+  merged_chunk->set_immutable();
+  _add_distinct_sketches(*merged_chunk);
+
+  // The delta is replaced by an empty chunk rather than erased, so that the ChunkIDs of later chunks do not change
+  auto empty_chunk = _create_value_chunk();
+  empty_chunk->set_immutable();
+
+  std::unique_lock write_lock(_chunk_access);
+  const auto delta_iter = std::find(_chunks.begin(), _chunks.end(), delta);
+  DebugAssert(delta_iter != _chunks.end(), "Delta was removed during the merge");
+  if (main) {
+    const auto main_iter = std::find(_chunks.begin(), delta_iter, main);
+    DebugAssert(main_iter != delta_iter, "Main was removed during the merge");
+    *main_iter = merged_chunk;
+    *delta_iter = empty_chunk;
+  } else {
+    *delta_iter = merged_chunk;
+  }
+}
+
+void Table::reorganize(const ColumnID column_id) {
+  reorganize(column_id, ChunkID{0}, chunk_count());
+}
+
+void Table::reorganize(const ColumnID column_id, const ChunkID begin_chunk_id, const ChunkID end_chunk_id) {
+  Assert(column_id < column_count(), "Column does not exist");
+  std::lock_guard merge_lock(_merge_mutex);
+
+  // Take a snapshot of the chunks to reorganize. If the last chunk is among them, rows that are appended from now on
+  // go into a new chunk.
+  auto old_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  {
+    std::unique_lock write_lock(_chunk_access);
+    const auto includes_last_chunk = static_cast<size_t>(end_chunk_id) == _chunks.size();
+    Assert(begin_chunk_id <= end_chunk_id && static_cast<size_t>(end_chunk_id) <= _chunks.size(),
+           "Invalid chunk range");
+    if (begin_chunk_id == end_chunk_id) return;
+    old_chunks.assign(_chunks.begin() + begin_chunk_id, _chunks.begin() + end_chunk_id);
+    if (includes_last_chunk && _is_mutable(*_chunks.back())) _chunks.push_back(_create_value_chunk());
+  }
+
+  // Sort the snapshot. The snapshot table shares the segments, so that nothing is copied.
+  auto snapshot = std::make_shared<Table>();
+  for (auto snapshot_column_id = ColumnID{0}; snapshot_column_id < column_count(); ++snapshot_column_id) {
+    snapshot->add_column(column_name(snapshot_column_id), column_type(snapshot_column_id));
+  }
+  for (const auto& old_chunk : old_chunks) {
+    if (old_chunk->size() == 0) continue;
+    auto snapshot_chunk = Chunk{};
+    for (auto snapshot_column_id = ColumnID{0}; snapshot_column_id < column_count(); ++snapshot_column_id) {
+      snapshot_chunk.add_segment(old_chunk->get_segment(snapshot_column_id));
+    }
+    snapshot->emplace_chunk(std::move(snapshot_chunk));
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(snapshot);
+  table_wrapper->execute();
+  auto sort = std::make_shared<Sort>(table_wrapper, std::vector<SortColumnDefinition>{{column_id}});
+  sort->execute();
+  const auto& sorted_segment = *sort->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  const auto& pos_list = *static_cast<const ReferenceSegment&>(sorted_segment).pos_list();
+  const auto sorted_row_count = pos_list.size();
+
+  // Gather and compress the new chunks, one job per chunk
+  const auto new_chunk_count = (sorted_row_count + _max_chunk_size - 1) / _max_chunk_size;
+  auto new_chunks = std::vector<std::shared_ptr<Chunk>>(new_chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto new_chunk_index = size_t{0}; new_chunk_index < new_chunk_count; ++new_chunk_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, new_chunk_index]() {
+      const auto begin = pos_list.cbegin() + new_chunk_index * _max_chunk_size;
+      const auto end = pos_list.cbegin() + std::min((new_chunk_index + 1) * _max_chunk_size, sorted_row_count);
+      const auto chunk_pos_list = std::make_shared<PosList>(begin, end);
+
+      auto new_chunk = _create_chunk();
+      for (auto new_column_id = ColumnID{0}; new_column_id < column_count(); ++new_column_id) {
+        const auto data_type = column_data_type(new_column_id);
+        resolve_data_type(data_type, [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          auto values = pmr_vector<ColumnDataType>(chunk_pos_list->size());
+          const auto reference_segment = ReferenceSegment{snapshot, new_column_id, chunk_pos_list};
+          segment_materialize<ColumnDataType>(reference_segment, values.data());
+          new_chunk->add_segment(encode_segment(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)),
+                                                data_type, SegmentEncoding::Dictionary, new_chunk->memory_resource()));
+        });
+      }
+      new_chunk->set_ordered_by(column_id);
+      new_chunk->set_immutable();
+      _add_distinct_sketches(*new_chunk);
+      new_chunks[new_chunk_index] = new_chunk;
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  std::unique_lock write_lock(_chunk_access);
+  const auto old_begin = std::find(_chunks.begin(), _chunks.end(), old_chunks.front());
+  Assert(_chunks.end() - old_begin >= static_cast<ptrdiff_t>(old_chunks.size()) &&
+             std::equal(old_chunks.cbegin(), old_chunks.cend(), old_begin),
+         "Chunks were replaced during the reorganization");
+  const auto insert_position = _chunks.erase(old_begin, old_begin + static_cast<ptrdiff_t>(old_chunks.size()));
+  _chunks.insert(insert_position, new_chunks.cbegin(), new_chunks.cend());
+  if (_chunks.empty()) _chunks.push_back(_create_value_chunk());
+}
+
+void Table::share_dictionaries(const ColumnID column_id) {
+  Assert(column_id < column_count(), "Column does not exist");
+  const auto data_type = column_data_type(column_id);
+  std::lock_guard merge_lock(_merge_mutex);
+
+  auto chunk_ids = std::vector<ChunkID>{};
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  auto old_segments = std::vector<std::shared_ptr<BaseSegment>>{};
+  {
+    std::shared_lock read_lock(_chunk_access);
+    for (auto chunk_id = ChunkID{0}; chunk_id < _chunks.size(); ++chunk_id) {
+      const auto& chunk = _chunks[chunk_id];
+      const auto segment = chunk->get_segment(column_id);
+      resolve_data_type(data_type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        if (segment_encoding<ColumnDataType>(*segment) != SegmentEncoding::Dictionary) return;
+        chunk_ids.push_back(chunk_id);
+        chunks.push_back(chunk);
+        old_segments.push_back(segment);
+      });
+    }
+  }
+  if (old_segments.empty()) return;
+
+  auto segments = std::vector<const BaseSegment*>{};
+  auto memory_resources = std::vector<std::pmr::memory_resource*>{};
+  for (auto segment_index = size_t{0}; segment_index < old_segments.size(); ++segment_index) {
+    segments.push_back(old_segments[segment_index].get());
+    memory_resources.push_back(chunks[segment_index]->memory_resource());
+  }
+  // With chunk arenas, the old attribute vectors are only released together with their chunk
+  // The dictionary outlives every single chunk, so it must not come from a chunk arena
+  const auto new_segments = share_dictionary(segments, data_type, _memory_resource, memory_resources);
+
+  // The segments are not swapped inside the chunks, which readers may access without a lock. Instead, every chunk is
+  // replaced by a copy that holds the new segment.
+  auto new_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  new_chunks.reserve(chunks.size());
+  for (auto segment_index = size_t{0}; segment_index < chunks.size(); ++segment_index) {
+    new_chunks.push_back(chunks[segment_index]->copy_with_segment(column_id, new_segments[segment_index]));
+  }
+
+  std::unique_lock write_lock(_chunk_access);
+  for (auto segment_index = size_t{0}; segment_index < chunks.size(); ++segment_index) {
+    const auto chunk_id = chunk_ids[segment_index];
+    DebugAssert(_chunks[chunk_id] == chunks[segment_index], "Chunk was replaced while sharing the dictionary");
+    _chunks[chunk_id] = new_chunks[segment_index];
+  }
+}
+
+HyperLogLog Table::distinct_sketch(const ColumnID column_id) const {
+  Assert(column_id < column_count(), "Column does not exist");
+
+  // Appends are blocked while chunks without a sketch, usually only the small delta, are sketched
+  std::shared_lock read_lock(_chunk_access);
+  auto sketch = HyperLogLog{};
+  for (const auto& chunk : _chunks) {
+    if (const auto chunk_sketch = chunk->distinct_sketch(column_id)) {
+      sketch.merge(*chunk_sketch);
+    } else {
+      sketch.merge(HyperLogLog::from_segment(*chunk->get_segment(column_id), column_data_type(column_id)));
+    }
+  }
+  return sketch;
+}
+
+size_t Table::approx_distinct_count(const ColumnID column_id) const { return distinct_sketch(column_id).estimate(); }
+
+std::pmr::memory_resource* Table::memory_resource() const { return _memory_resource; }
+
+std::shared_ptr<Chunk> Table::_create_value_chunk() const {
+  auto chunk = _create_chunk();
+  for (const auto data_type : _column_data_types) {
+    chunk->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(data_type, chunk->memory_resource()));
+  }
+  return chunk;
+}
+
+bool Table::_is_mutable(const Chunk& chunk) const {
+  if (!chunk.is_mutable()) return false;
+  if (chunk.column_count() == 0) return true;
+
+  auto is_value_segment = false;
+  resolve_data_type(_column_data_types.front(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto segment = chunk.get_segment(ColumnID{0});
+    is_value_segment = static_cast<bool>(std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment));
+  });
+  return is_value_segment;
+}
+
+void Table::_add_distinct_sketches(Chunk& chunk) const {
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    chunk.set_distinct_sketch(column_id, std::make_shared<HyperLogLog>(HyperLogLog::from_segment(
+                                             *chunk.get_segment(column_id), column_data_type(column_id))));
+  }
+}
+
+std::shared_ptr<Chunk> Table::_create_chunk() const { return std::make_shared<Chunk>(_create_memory_resource()); }
+
+std::shared_ptr<std::pmr::memory_resource> Table::_create_memory_resource() const {
+  if (!_use_chunk_arenas) {
+    if (_huge_page_resource) return _huge_page_resource;
+    // The table's resource is not owned by the chunk, hence the no-op deleter
+    return std::shared_ptr<std::pmr::memory_resource>(_memory_resource, [](auto*) {});
+  }
+
+  // A monotonic arena never reuses memory, so the buffers left behind by a growing value segment stay allocated
+  // until the chunk is dropped. This at most doubles the footprint of a value chunk and is gone after compression.
+  if (!_huge_page_resource) return std::make_shared<std::pmr::monotonic_buffer_resource>(_memory_resource);
+
+  // Starting with a huge page makes every block of the arena large enough to be mapped to huge pages. The deleter
+  // keeps the huge page resource alive until the arena has returned its blocks.
+  return std::shared_ptr<std::pmr::memory_resource>(
+      new std::pmr::monotonic_buffer_resource(HugePageMemoryResource::HUGE_PAGE_SIZE, _huge_page_resource.get()),
+      [huge_page_resource = _huge_page_resource](std::pmr::memory_resource* arena) { delete arena; });
 }
 
 }  // namespace opossum
@@ -1,8 +1,12 @@
 #pragma once
 
+// the linter wants this to be above everything else
+#include <memory_resource>
+
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <utility>
@@ -10,6 +14,8 @@
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "hyper_log_log.hpp"
+#include "utils/huge_page_memory_resource.hpp"
 
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -25,7 +31,18 @@ class Table : private Noncopyable {
   // creates a table
   // the parameter specifies the maximum chunk size, i.e., partition size
   // default is the maximum chunk size minus 1. A table holds always at least one chunk
-  explicit Table(const uint32_t chunk_size = std::numeric_limits<ChunkOffset>::max() - 1);
+  //
+  // All segments of the table are allocated from memory_resource. If use_chunk_arenas is set, every chunk gets its
+  // own monotonic arena (with memory_resource as upstream). Segment data then is allocated in a few large blocks and
+  // released at once when the chunk and the last of its segments are dropped. Segments are built by several threads,
+  // so memory_resource has to be thread-safe, while the arenas are only ever used by one thread at a time.
+  //
+  // If use_huge_pages is set, large allocations are served from huge pages (see HugePageMemoryResource) before they
+  // reach memory_resource. Every block of a chunk arena then is a huge page of its own, so that scans of large chunks
+  // need fewer TLB entries. As each chunk takes at least one huge page, this only pays off for large chunks.
+  explicit Table(const uint32_t chunk_size = std::numeric_limits<ChunkOffset>::max() - 1,
+                 std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource(),
+                 const bool use_chunk_arenas = false, const bool use_huge_pages = false);
 
   // we need to explicitly set the move constructor to default when
   // we overwrite the copy constructor
@@ -43,10 +60,20 @@ class Table : private Noncopyable {
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
-  // returns the chunk with the given id
+  // Returns the chunk with the given id. The reference is only valid until the chunk is replaced, i.e., by
+  // compress_chunk, merge_delta, reorganize, or share_dictionaries. Operators read chunks through get_chunk_snapshot.
   Chunk& get_chunk(ChunkID chunk_id);
   const Chunk& get_chunk(ChunkID chunk_id) const;
 
+  // Returns the chunk with the given id, which stays valid when it is replaced in the table. Use this when chunks may
+  // be replaced while you read them.
+  std::shared_ptr<const Chunk> get_chunk_snapshot(ChunkID chunk_id) const;
+
+  // Returns a table that holds the rows of this one at the time of the call and never changes. It shares all chunks
+  // but the last one if rows can still be appended to that, which is copied. RowIDs into the snapshot stay valid for
+  // as long as it lives, even if chunks of this table are compressed, merged, or reorganized in the meantime.
+  std::shared_ptr<const Table> snapshot() const;
+
   // Adds a chunk to the table. If the first chunk is empty, it is replaced.
   void emplace_chunk(Chunk chunk);
 
@@ -59,6 +86,9 @@ class Table : private Noncopyable {
   // returns the column type of the nth column
   const std::string& column_type(ColumnID column_id) const;
 
+  // returns the data type of the nth column. Prefer this over column_type() when resolving types.
+  DataType column_data_type(ColumnID column_id) const;
+
   // Returns the column with the given name.
   // This method is intended for debugging purposes only.
   // It does not verify whether a column name is unambiguous.
@@ -73,19 +103,94 @@ class Table : private Noncopyable {
   void add_column(const std::string& name, const std::string& type);
 
   // inserts a row at the end of the table
-  // note this is slow and not thread-safe and should be used for testing purposes only
+  // note this is slow and should be used for testing purposes only
+  // If the last chunk is compressed, the row goes into a new chunk of ValueSegments, the delta.
   void append(std::vector<AllTypeVariant> values);
 
   // compresses a ValueColumn into a DictionaryColumn
   void compress_chunk(ChunkID chunk_id);
 
+  // compresses the segments of a chunk with the given encodings, one per column. See EncodingAdvisor for choosing
+  // them automatically. Like all compressed chunks, the chunk becomes immutable.
+  void compress_chunk(ChunkID chunk_id, const EncodingSpec& encoding_spec);
+
+  // Merges the delta (the oldest chunk that is not compressed, usually the last one) into the compressed chunk before
+  // it, the main. If there is no main or it has no room for the delta, the delta is compressed on its own and becomes
+  // the new main. Call it repeatedly to merge several deltas.
+  //
+  // The merge is meant to run in the background: only the swap of the chunks blocks other threads. Rows that are
+  // appended in the meantime go into a new delta. Main and delta are replaced in one critical section, so that a
+  // reader never sees the rows of the delta twice or not at all. Readers that hold the old main and delta through
+  // get_chunk_snapshot can keep reading them; references from get_chunk must not be used across a merge. Readers that
+  // walk over several chunks, e.g., operators, read from a snapshot() of the table, which GetTable takes.
+  //
+  // The merged chunk takes the ChunkID of the main, or that of the delta if there is no main. An empty chunk is left
+  // in place of a delta that was merged into the main, so that only the ChunkIDs of the rows in the delta change.
+  // Reorganizing the table drops these empty chunks.
+  void merge_delta();
+
+  // Sorts the rows of the chunks [begin_chunk_id, end_chunk_id) by a column, splits them into chunks of
+  // max_chunk_size rows, and dictionary-compresses these. The new chunks are flagged as ordered by the column, so that
+  // operators can skip sorting and binary-search them, and they replace the old ones at once. Until then, readers see
+  // the old chunks. The ChunkIDs of all rows from begin_chunk_id onwards may change.
+  //
+  // Rows that are appended in the meantime go into a new chunk, which is not reorganized. Reorganizations are
+  // serialized with merges of the delta.
+  void reorganize(const ColumnID column_id, const ChunkID begin_chunk_id, const ChunkID end_chunk_id);
+
+  // reorganizes all chunks of the table, see above
+  void reorganize(const ColumnID column_id);
+
+  // Replaces the dictionaries of all dictionary-compressed segments of a column with a single one that they share. A
+  // ValueID then stands for the same value in every chunk, so that operators can group and compare rows of different
+  // chunks by their ValueIDs, and values that occur in many chunks are stored only once.
+  //
+  // The shared dictionary is sorted like any other, so it cannot be extended in place. Chunks that are compressed,
+  // merged, or reorganized later get their own dictionaries again; call this periodically to rebuild the shared one.
+  // Every affected chunk is replaced by a copy with the new segment, so readers that hold the old chunk (see
+  // get_chunk_snapshot) keep the old segment, which holds the same rows. Serialized with compressions, merges of the
+  // delta, and reorganizations.
+  void share_dictionaries(const ColumnID column_id);
+
+  // Returns a sketch of the distinct values of a column, merged from the sketches that are stored with the chunks when
+  // they are compressed. Chunks without a sketch, e.g., the delta, are sketched on the fly.
+  HyperLogLog distinct_sketch(const ColumnID column_id) const;
+
+  // Returns the approximate number of distinct values of a column, i.e., COUNT(DISTINCT column) (see HyperLogLog)
+  size_t approx_distinct_count(const ColumnID column_id) const;
+
+  // returns the memory resource that is used as upstream for all allocations of this table
+  std::pmr::memory_resource* memory_resource() const;
+
  protected:
+  // creates an empty chunk, with its own arena if chunk arenas are used
+  std::shared_ptr<Chunk> _create_chunk() const;
+
+  // returns a new arena if chunk arenas are used, the memory resource of the table otherwise
+  std::shared_ptr<std::pmr::memory_resource> _create_memory_resource() const;
+
+  // creates an empty chunk with a ValueSegment for every column
+  std::shared_ptr<Chunk> _create_value_chunk() const;
+
+  // returns whether rows can be appended to a chunk, i.e., whether it is not compressed
+  bool _is_mutable(const Chunk& chunk) const;
+
+  // stores a sketch of the distinct values of every column with a chunk
+  void _add_distinct_sketches(Chunk& chunk) const;
+
   // Implementation goes here
   std::vector<std::shared_ptr<Chunk>> _chunks;
   std::vector<std::string> _column_types;
+  std::vector<DataType> _column_data_types;
   std::vector<std::string> _column_names;
   ChunkOffset _max_chunk_size;
+  std::pmr::memory_resource* _memory_resource;
+  bool _use_chunk_arenas;
+  // Upstream of the chunk arenas if huge pages are used. Shared with the arenas, which may outlive the table.
+  std::shared_ptr<HugePageMemoryResource> _huge_page_resource;
   mutable std::shared_mutex _chunk_access;
+  // Serializes compressions, merges of the delta, and reorganizations, which all replace chunks
+  std::mutex _merge_mutex;
 };
 
 }  // namespace opossum
@@ -14,7 +14,10 @@
 namespace opossum {
 
 template <typename T>
-ValueSegment<T>::ValueSegment() : _values{std::vector<T>()} {}
+ValueSegment<T>::ValueSegment(const PolymorphicAllocator<T>& alloc) : _values{alloc} {}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(pmr_vector<T>&& values) : _values{std::move(values)} {}
 
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
@@ -39,10 +42,17 @@ size_t ValueSegment<T>::estimate_memory_usage() const {
 }
 
 template <typename T>
-const std::vector<T>& ValueSegment<T>::values() const {
+const pmr_vector<T>& ValueSegment<T>::values() const {
   return _values;
 }
 
+template <typename T>
+void ValueSegment<T>::materialize(const PosList& pos_list, const size_t begin, const size_t end, T* out) const {
+  for_each_prefetched_position(
+      pos_list, begin, end, [&](const ChunkOffset chunk_offset) { __builtin_prefetch(&_values[chunk_offset]); },
+      [&](const ChunkOffset chunk_offset) { *out++ = _values[chunk_offset]; });
+}
+
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ValueSegment);
 
 }  // namespace opossum
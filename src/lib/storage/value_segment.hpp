@@ -13,7 +13,10 @@ namespace opossum {
 template <typename T>
 class ValueSegment : public BaseSegment {
  public:
-  ValueSegment();
+  explicit ValueSegment(const PolymorphicAllocator<T>& alloc = {});
+
+  // creates a segment that takes over the given values, e.g., from a data generator
+  explicit ValueSegment(pmr_vector<T>&& values);
 
   // return the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
@@ -27,14 +30,17 @@ class ValueSegment : public BaseSegment {
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
-  const std::vector<T>& values() const;
+  const pmr_vector<T>& values() const;
+
+  // writes the values at the chunk offsets of pos_list[begin, end) to out (see BaseSegment)
+  void materialize(const PosList& pos_list, const size_t begin, const size_t end, T* out) const;
 
   // returns the calculated memory usage
   size_t estimate_memory_usage() const final;
 
  protected:
   // Implementation goes here
-  std::vector<T> _values;
+  pmr_vector<T> _values;
 };
 
 }  // namespace opossum
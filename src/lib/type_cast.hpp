@@ -1,15 +1,22 @@
 #pragma once
 
+// the linter wants this to be above everything else
+#include <charconv>
+
 #include <boost/hana/contains.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/not_equal.hpp>
 #include <boost/hana/size.hpp>
 #include <boost/hana/take_while.hpp>
-#include <boost/lexical_cast.hpp>
 
+#include <cmath>
+#include <limits>
 #include <string>
+#include <system_error>
+#include <type_traits>
 
 #include "all_type_variant.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -24,6 +31,86 @@ constexpr auto index_of(Sequence const& sequence, T const& element) {
   return decltype(size)::value;
 }
 
+// Converts between two numeric types. Floating point values are truncated towards zero when converted to integers.
+template <typename Target, typename Source>
+std::errc convert_number(const Source source, Target& target) {
+  if constexpr (std::is_integral_v<Target> && std::is_floating_point_v<Source>) {
+    // All integral data types are signed, so [min, -min) is exactly representable as floating point range
+    const auto truncated = std::trunc(source);
+    constexpr auto lower_bound = static_cast<Source>(std::numeric_limits<Target>::min());
+    if (!(truncated >= lower_bound && truncated < -lower_bound)) return std::errc::result_out_of_range;
+  }
+
+  if constexpr (std::is_integral_v<Target> && std::is_integral_v<Source>) {
+    if (source < std::numeric_limits<Target>::min() || source > std::numeric_limits<Target>::max()) {
+      return std::errc::result_out_of_range;
+    }
+  }
+
+  if constexpr (std::is_floating_point_v<Target> && std::is_floating_point_v<Source>) {
+    if (std::isfinite(source) && std::abs(source) > std::numeric_limits<Target>::max()) {
+      return std::errc::result_out_of_range;
+    }
+  }
+
+  target = static_cast<Target>(source);
+  return std::errc();
+}
+
+// Parses a number that has to span the entire string. Like boost::lexical_cast, a leading '+' is accepted.
+template <typename Target>
+std::errc parse_number(const std::string& source, Target& target) {
+  const auto* begin = source.data();
+  const auto* const end = source.data() + source.size();
+  if (begin != end && *begin == '+' && begin + 1 != end && *(begin + 1) != '-') ++begin;
+
+  auto value = Target{};
+  const auto parse_result = std::from_chars(begin, end, value);
+  if (parse_result.ec == std::errc() && parse_result.ptr == end) {
+    target = value;
+    return std::errc();
+  }
+
+  if constexpr (std::is_integral_v<Target>) {
+    // Integral columns accept strings with fractional digits, e.g., "3.5", which are truncated
+    if (parse_result.ec == std::errc::invalid_argument || parse_result.ptr != end) {
+      auto floating_point_value = double{};
+      const auto floating_point_parse_result = std::from_chars(begin, end, floating_point_value);
+      if (floating_point_parse_result.ec != std::errc()) return floating_point_parse_result.ec;
+      if (floating_point_parse_result.ptr != end) return std::errc::invalid_argument;
+      return convert_number(floating_point_value, target);
+    }
+  }
+
+  return parse_result.ec == std::errc() ? std::errc::invalid_argument : parse_result.ec;
+}
+
+// Prints a number. Floating point values use the shortest representation that parses back to the same value.
+template <typename Source>
+std::errc print_number(const Source source, std::string& target) {
+  // Enough for any 64 bit integer and the shortest round trip representation of a double
+  char buffer[32];
+  const auto print_result = std::to_chars(buffer, buffer + sizeof(buffer), source);
+  if (print_result.ec != std::errc()) return print_result.ec;
+
+  target.assign(buffer, print_result.ptr);
+  return std::errc();
+}
+
+template <typename Target, typename Source>
+std::errc convert(const Source& source, Target& target) {
+  if constexpr (std::is_same_v<Target, Source>) {
+    target = source;
+    return std::errc();
+  } else if constexpr (std::is_same_v<Source, std::string>) {  // NOLINT
+    return parse_number(source, target);
+  } else if constexpr (std::is_same_v<Target, std::string>) {  // NOLINT
+    return print_number(source, target);
+  } else {
+    return convert_number(source, target);
+  }
+}
+
 }  // namespace detail
 
 // Retrieves the value stored in an AllTypeVariant without conversion
@@ -33,26 +120,29 @@ const T& get(const AllTypeVariant& value) {
   return boost::get<T>(value);
 }
 
-// cast methods - from variant to specific type
-
-// Template specialization for everything but integral types
+// Converts the value stored in an AllTypeVariant into T without throwing.
+// Numbers are widened and narrowed directly (floating point values are truncated towards zero), strings are parsed
+// with std::from_chars and printed with std::to_chars. Returns std::errc() on success,
+// std::errc::invalid_argument if a string does not hold a number, and std::errc::result_out_of_range if the value
+// does not fit into T. result is only written on success.
 template <typename T>
-std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
-
-  return boost::lexical_cast<T>(value);
+std::errc try_type_cast(const AllTypeVariant& value, T& result) {
+  static_assert(hana::contains(types, hana::type_c<T>), "Type not in AllTypeVariant");
+  return boost::apply_visitor([&](const auto& source) { return detail::convert(source, result); }, value);
 }
 
-// Template specialization for integral types
+// returns the string representation of the value stored in an AllTypeVariant
+std::string to_string(const AllTypeVariant& value);
+
+// cast methods - from variant to specific type
+// Fails if the value cannot be converted, see try_type_cast
 template <typename T>
-std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
+T type_cast(const AllTypeVariant& value) {
   if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
 
-  try {
-    return boost::lexical_cast<T>(value);
-  } catch (...) {
-    return boost::numeric_cast<T>(boost::lexical_cast<double>(value));
-  }
+  auto result = T{};
+  if (try_type_cast(value, result) != std::errc()) Fail("Cannot convert '" + to_string(value) + "'");
+  return result;
 }
 
 }  // namespace opossum
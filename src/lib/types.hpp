@@ -1,5 +1,8 @@
 #pragma once
 
+// the linter wants this to be above everything else
+#include <memory_resource>
+
 #include <cstdint>
 #include <iostream>
 #include <limits>
@@ -53,8 +56,22 @@ struct RowID {
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
+// The ways in which a segment can store its values. StringHeap is only available for strings.
+enum class SegmentEncoding : uint8_t { Unencoded, Dictionary, StringHeap };
+
+// The encodings of the segments of a chunk, one per column
+using EncodingSpec = std::vector<SegmentEncoding>;
+
 using PosList = std::vector<RowID>;
 
+// Segments and attribute vectors take a polymorphic allocator so that the caller decides where their data lives,
+// e.g., in a per-chunk arena (see Table) or in huge pages (see HugePageMemoryResource).
+template <typename T>
+using PolymorphicAllocator = std::pmr::polymorphic_allocator<T>;
+
+template <typename T>
+using pmr_vector = std::vector<T, PolymorphicAllocator<T>>;
+
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
  protected:
@@ -0,0 +1,38 @@
+#include "counting_memory_resource.hpp"
+
+namespace opossum {
+
+CountingMemoryResource::CountingMemoryResource(std::pmr::memory_resource* upstream) : _upstream{upstream} {}
+
+size_t CountingMemoryResource::allocation_count() const { return _allocation_count; }
+
+size_t CountingMemoryResource::deallocation_count() const { return _deallocation_count; }
+
+size_t CountingMemoryResource::allocated_bytes() const { return _allocated_bytes; }
+
+size_t CountingMemoryResource::live_bytes() const { return _allocated_bytes - _deallocated_bytes; }
+
+void CountingMemoryResource::reset() {
+  _allocation_count = 0;
+  _deallocation_count = 0;
+  _allocated_bytes = 0;
+  _deallocated_bytes = 0;
+}
+
+void* CountingMemoryResource::do_allocate(size_t bytes, size_t alignment) {
+  ++_allocation_count;
+  _allocated_bytes += bytes;
+  return _upstream->allocate(bytes, alignment);
+}
+
+void CountingMemoryResource::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+  ++_deallocation_count;
+  _deallocated_bytes += bytes;
+  _upstream->deallocate(pointer, bytes, alignment);
+}
+
+bool CountingMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+}  // namespace opossum
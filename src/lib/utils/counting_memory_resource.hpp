@@ -0,0 +1,42 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <memory_resource>
+
+#include <atomic>
+#include <cstddef>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// CountingMemoryResource forwards all requests to an upstream resource and counts them. It is used to measure how
+// many allocations building or dropping a table causes, e.g., to compare per-chunk arenas with the default heap.
+class CountingMemoryResource : public std::pmr::memory_resource {
+ public:
+  explicit CountingMemoryResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+  // returns the number of calls to allocate and deallocate
+  size_t allocation_count() const;
+  size_t deallocation_count() const;
+
+  // returns the number of bytes that have been allocated in total / that are currently allocated
+  size_t allocated_bytes() const;
+  size_t live_bytes() const;
+
+  // sets all counters to zero
+  void reset();
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  std::pmr::memory_resource* const _upstream;
+  std::atomic<size_t> _allocation_count{0};
+  std::atomic<size_t> _deallocation_count{0};
+  std::atomic<size_t> _allocated_bytes{0};
+  std::atomic<size_t> _deallocated_bytes{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#include "huge_page_memory_resource.hpp"
+
+#include <sys/mman.h>
+
+#include <cstdint>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+size_t round_up_to_huge_pages(const size_t bytes) {
+  return (bytes + HugePageMemoryResource::HUGE_PAGE_SIZE - 1) / HugePageMemoryResource::HUGE_PAGE_SIZE *
+         HugePageMemoryResource::HUGE_PAGE_SIZE;
+}
+
+}  // namespace
+
+HugePageMemoryResource::HugePageMemoryResource(const size_t threshold, std::pmr::memory_resource* upstream)
+    : _threshold{threshold}, _upstream{upstream} {}
+
+HugePageMemoryResource& HugePageMemoryResource::get() {
+  static HugePageMemoryResource instance;
+  return instance;
+}
+
+size_t HugePageMemoryResource::threshold() const { return _threshold; }
+
+void* HugePageMemoryResource::do_allocate(size_t bytes, size_t alignment) {
+  if (bytes < _threshold) return _upstream->allocate(bytes, alignment);
+
+  Assert(alignment <= HUGE_PAGE_SIZE, "Alignment exceeds huge page size");
+  const auto mapping_size = round_up_to_huge_pages(bytes);
+
+  // Transparent huge pages are only used for 2 MiB aligned ranges. mmap only guarantees page alignment, so we map
+  // an additional huge page and trim the misaligned head and the unused tail.
+  auto* const raw = static_cast<char*>(
+      mmap(nullptr, mapping_size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+  Assert(raw != MAP_FAILED, "Could not map memory for huge pages");
+
+  const auto raw_address = reinterpret_cast<uintptr_t>(raw);
+  const auto head = (HUGE_PAGE_SIZE - raw_address % HUGE_PAGE_SIZE) % HUGE_PAGE_SIZE;
+  auto* const aligned = raw + head;
+  if (head > 0) munmap(raw, head);
+  const auto tail = HUGE_PAGE_SIZE - head;
+  if (tail > 0) munmap(aligned + mapping_size, tail);
+
+#ifdef MADV_HUGEPAGE
+  // This is only a hint. If the kernel has no huge pages available, we silently fall back to regular pages.
+  madvise(aligned, mapping_size, MADV_HUGEPAGE);
+#endif
+
+  return aligned;
+}
+
+void HugePageMemoryResource::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+  if (bytes < _threshold) {
+    _upstream->deallocate(pointer, bytes, alignment);
+    return;
+  }
+
+  munmap(pointer, round_up_to_huge_pages(bytes));
+}
+
+bool HugePageMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+}  // namespace opossum
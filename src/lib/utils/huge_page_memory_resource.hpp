@@ -0,0 +1,37 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <memory_resource>
+
+#include <cstddef>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// HugePageMemoryResource serves large allocations from anonymous mappings that are advised to be backed by
+// transparent huge pages (2 MiB on x86). Large segments then need far fewer TLB entries when they are scanned.
+// Allocations below the threshold are not worth a mapping of their own and are forwarded to the upstream resource.
+// It is a good upstream for the per-chunk arenas of a Table, as those request memory in large blocks.
+class HugePageMemoryResource : public std::pmr::memory_resource {
+ public:
+  static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+  explicit HugePageMemoryResource(const size_t threshold = HUGE_PAGE_SIZE,
+                                  std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+  // returns a process-wide instance with the default threshold
+  static HugePageMemoryResource& get();
+
+  size_t threshold() const;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  const size_t _threshold;
+  std::pmr::memory_resource* const _upstream;
+};
+
+}  // namespace opossum
@@ -2,13 +2,32 @@
 
 #include <fstream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
 
+namespace {
+
+bool is_sorted(const BaseSegment& segment, const DataType data_type) {
+  auto sorted = true;
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    auto previous_value = std::optional<SegmentValue<ColumnDataType>>{};
+    segment_for_each<ColumnDataType>(segment, [&](const ChunkOffset, const auto& value) {
+      if (previous_value && value < *previous_value) sorted = false;
+      previous_value = value;
+    });
+  });
+  return sorted;
+}
+
+}  // namespace
+
 std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
   std::ifstream infile(file_name);
   Assert(infile.is_open(), "load_table: Could not find file " + file_name);
@@ -28,6 +47,17 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
     std::vector<AllTypeVariant> values = _split<AllTypeVariant>(line, '|');
     test_table->append(values);
   }
+
+  // Flag every chunk as ordered by its first sorted column, so that operators can make use of it
+  for (auto chunk_id = ChunkID{0}; chunk_id < test_table->chunk_count(); ++chunk_id) {
+    auto& chunk = test_table->get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+      if (is_sorted(*chunk.get_segment(column_id), test_table->column_data_type(column_id))) {
+        chunk.set_ordered_by(column_id);
+        break;
+      }
+    }
+  }
   return test_table;
 }
 
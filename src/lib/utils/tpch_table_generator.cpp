@@ -0,0 +1,573 @@
+#include "tpch_table_generator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// splitmix64 finalizer, see http://xoshiro.di.unimi.it/splitmix64.c
+uint64_t mix(uint64_t value) {
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+  return value ^ (value >> 31);
+}
+
+// Counter-based random number generator. Each row gets its own stream, so rows can be generated in any order and by
+// any thread without changing the result.
+class RowRandom {
+ public:
+  RowRandom(const uint64_t seed, const TpchTable table, const uint64_t row)
+      : _state(mix(seed ^ mix((static_cast<uint64_t>(table) + 1) << 56 ^ row))) {}
+
+  uint64_t next() {
+    _state += 0x9e3779b97f4a7c15ull;
+    return mix(_state);
+  }
+
+  // uniformly distributed in [min, max]
+  int64_t integer(const int64_t min, const int64_t max) {
+    return min + static_cast<int64_t>(next() % static_cast<uint64_t>(max - min + 1));
+  }
+
+  // uniformly distributed in [min_cents / 100, max_cents / 100] with two decimal places
+  float decimal(const int64_t min_cents, const int64_t max_cents) {
+    return static_cast<float>(integer(min_cents, max_cents)) / 100.0f;
+  }
+
+  template <size_t N>
+  const char* pick(const std::array<const char*, N>& choices) {
+    return choices[next() % N];
+  }
+
+  // a sequence of words with a random length in [min_length, max_length]
+  std::string text(const size_t min_length, const size_t max_length);
+
+  // random characters from [0-9a-zA-Z,] with a random length in [min_length, max_length]
+  std::string alphanumeric(const size_t min_length, const size_t max_length);
+
+  // phone number with the country code of the given nation
+  std::string phone(const int32_t nation_key);
+
+ protected:
+  uint64_t _state;
+};
+
+const auto WORDS = std::array{
+    "furiously", "sly", "careful", "blithely", "quickly", "fluffily", "slyly", "ironic", "final", "express", "regular",
+    "special", "pending", "bold", "even", "silent", "unusual", "packages", "requests", "accounts", "deposits", "foxes",
+    "ideas", "theodolites", "pinto", "beans", "instructions", "dependencies", "excuses", "platelets", "asymptotes",
+    "courts", "dolphins", "sleep", "wake", "are", "cajole", "haggle", "nag", "use", "boost", "affix", "detect",
+    "integrate", "maintain", "nod", "was", "along", "above", "according", "across", "after", "among", "around",
+    "about"};
+
+std::string RowRandom::text(const size_t min_length, const size_t max_length) {
+  const auto length = static_cast<size_t>(integer(min_length, max_length));
+  auto text = std::string{};
+  text.reserve(length + 16);
+  while (text.size() < length) {
+    if (!text.empty()) text += ' ';
+    text += pick(WORDS);
+  }
+  text.resize(length);
+  return text;
+}
+
+std::string RowRandom::alphanumeric(const size_t min_length, const size_t max_length) {
+  static constexpr char characters[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ,";
+  const auto length = static_cast<size_t>(integer(min_length, max_length));
+  auto text = std::string(length, ' ');
+  for (auto& character : text) {
+    character = characters[next() % (sizeof(characters) - 1)];
+  }
+  return text;
+}
+
+std::string RowRandom::phone(const int32_t nation_key) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%02d-%03d-%03d-%04d", nation_key + 10, static_cast<int>(integer(100, 999)),
+                static_cast<int>(integer(100, 999)), static_cast<int>(integer(1000, 9999)));
+  return buffer;
+}
+
+// e.g., "Supplier#000000042"
+std::string numbered_name(const char* prefix, const int64_t number) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%s#%09ld", prefix, static_cast<long>(number));  // NOLINT
+  return buffer;
+}
+
+// Days since 1970-01-01, see http://howardhinnant.github.io/date_algorithms.html
+constexpr int32_t days_from_civil(int32_t year, const uint32_t month, const uint32_t day) {
+  year -= month <= 2;
+  const auto era = (year >= 0 ? year : year - 399) / 400;
+  const auto year_of_era = static_cast<uint32_t>(year - era * 400);
+  const auto day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const auto day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + static_cast<int32_t>(day_of_era) - 719468;
+}
+
+std::string date_to_string(int32_t days) {
+  days += 719468;
+  const auto era = (days >= 0 ? days : days - 146096) / 146097;
+  const auto day_of_era = static_cast<uint32_t>(days - era * 146097);
+  const auto year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+  const auto day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const auto shifted_month = (5 * day_of_year + 2) / 153;
+  const auto day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+  const auto month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+  const auto year = static_cast<int32_t>(year_of_era) + era * 400 + (month <= 2);
+
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u", year, month, day);
+  return buffer;
+}
+
+constexpr auto START_DATE = days_from_civil(1992, 1, 1);
+constexpr auto END_DATE = days_from_civil(1998, 12, 31);
+constexpr auto CURRENT_DATE = days_from_civil(1995, 6, 17);
+
+const auto REGIONS = std::array{"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+
+const auto NATIONS = std::array<std::pair<const char*, int32_t>, 25>{
+    {{"ALGERIA", 0},       {"ARGENTINA", 1},    {"BRAZIL", 1},         {"CANADA", 1},         {"EGYPT", 4},
+     {"ETHIOPIA", 0},      {"FRANCE", 3},       {"GERMANY", 3},        {"INDIA", 2},          {"INDONESIA", 2},
+     {"IRAN", 4},          {"IRAQ", 4},         {"JAPAN", 2},          {"JORDAN", 4},         {"KENYA", 0},
+     {"MOROCCO", 0},       {"MOZAMBIQUE", 0},   {"PERU", 1},           {"CHINA", 2},          {"ROMANIA", 3},
+     {"SAUDI ARABIA", 4},  {"VIETNAM", 2},      {"RUSSIA", 3},         {"UNITED KINGDOM", 3}, {"UNITED STATES", 1}}};
+
+const auto SEGMENTS = std::array{"AUTOMOBILE", "BUILDING", "FURNITURE", "MACHINERY", "HOUSEHOLD"};
+const auto PRIORITIES = std::array{"1-URGENT", "2-HIGH", "3-MEDIUM", "4-NOT SPECIFIED", "5-LOW"};
+const auto SHIP_INSTRUCTIONS = std::array{"DELIVER IN PERSON", "COLLECT COD", "NONE", "TAKE BACK RETURN"};
+const auto SHIP_MODES = std::array{"REG AIR", "AIR", "RAIL", "SHIP", "TRUCK", "MAIL", "FOB"};
+const auto TYPE_SYLLABLES_1 = std::array{"STANDARD", "SMALL", "MEDIUM", "LARGE", "ECONOMY", "PROMO"};
+const auto TYPE_SYLLABLES_2 = std::array{"ANODIZED", "BURNISHED", "PLATED", "POLISHED", "BRUSHED"};
+const auto TYPE_SYLLABLES_3 = std::array{"TIN", "NICKEL", "BRASS", "STEEL", "COPPER"};
+const auto CONTAINER_SYLLABLES_1 = std::array{"SM", "LG", "MED", "JUMBO", "WRAP"};
+const auto CONTAINER_SYLLABLES_2 = std::array{"CASE", "BOX", "BAG", "JAR", "PKG", "PACK", "CAN", "DRUM"};
+const auto COLORS = std::array{
+    "almond", "antique", "aquamarine", "azure", "beige", "bisque", "black", "blanched", "blue", "blush", "brown",
+    "burlywood", "burnished", "chartreuse", "chiffon", "chocolate", "coral", "cornflower", "cornsilk", "cream", "cyan",
+    "dark", "deep", "dim", "dodger", "drab", "firebrick", "floral", "forest", "frosted", "gainsboro", "ghost",
+    "goldenrod", "green", "grey", "honeydew", "hot", "indian", "ivory", "khaki", "lace", "lavender", "lawn", "lemon",
+    "light", "lime", "linen", "magenta", "maroon", "medium", "metallic", "midnight", "mint", "misty", "moccasin",
+    "navajo", "navy", "olive", "orange", "orchid", "pale", "papaya", "peach", "peru", "pink", "plum", "powder", "puff",
+    "purple", "red", "rose", "rosy", "royal", "saddle", "salmon", "sandy", "seashell", "sienna", "sky", "slate",
+    "smoke", "snow", "spring", "steel", "tan", "thistle", "tomato", "turquoise", "violet", "wheat", "white", "yellow"};
+
+// Collects the values of one chunk column by column and turns them into ValueSegments
+template <typename... Types>
+class ChunkBuilder {
+ public:
+  explicit ChunkBuilder(const size_t row_count) {
+    std::apply([&](auto&... columns) { (columns.reserve(row_count), ...); }, _columns);
+  }
+
+  static std::vector<DataType> data_types() { return {data_type_of<Types>...}; }
+
+  void append(Types... values) {
+    std::apply([&](auto&... columns) { (columns.push_back(std::move(values)), ...); }, _columns);
+  }
+
+  Chunk build() {
+    auto chunk = Chunk{};
+    std::apply(
+        [&](auto&... columns) {
+          (chunk.add_segment(std::make_shared<ValueSegment<Types>>(std::move(columns))), ...);
+        },
+        _columns);
+    return chunk;
+  }
+
+ protected:
+  std::tuple<pmr_vector<Types>...> _columns;
+};
+
+// Creates a table with the columns of Builder and generates its chunks in parallel. chunk_function(builder,
+// begin_row, end_row) appends the rows [begin_row, end_row) to the builder.
+template <typename Builder, typename ChunkFunction>
+std::shared_ptr<Table> generate_chunked_table(const std::vector<std::string>& column_names, const size_t row_count,
+                                              const uint32_t chunk_size, const uint32_t thread_count,
+                                              const ChunkFunction& chunk_function) {
+  const auto data_types = Builder::data_types();
+  DebugAssert(data_types.size() == column_names.size(), "Number of column names does not match number of columns");
+
+  auto table = std::make_shared<Table>(chunk_size);
+  for (auto column_id = size_t{0}; column_id < column_names.size(); ++column_id) {
+    table->add_column(column_names[column_id], data_type_to_string(data_types[column_id]));
+  }
+
+  const auto chunk_count = (row_count + chunk_size - 1) / chunk_size;
+  auto chunks = std::vector<Chunk>(chunk_count);
+  auto next_chunk = std::atomic<size_t>{0};
+
+  const auto worker = [&]() {
+    for (auto chunk_index = next_chunk++; chunk_index < chunk_count; chunk_index = next_chunk++) {
+      const auto begin_row = chunk_index * chunk_size;
+      const auto end_row = std::min(begin_row + chunk_size, row_count);
+
+      auto builder = Builder{end_row - begin_row};
+      chunk_function(builder, begin_row, end_row);
+      chunks[chunk_index] = builder.build();
+    }
+  };
+
+  auto threads = std::vector<std::thread>{};
+  const auto worker_count = std::min(static_cast<size_t>(thread_count), chunk_count);
+  for (auto thread_index = size_t{0}; thread_index < worker_count; ++thread_index) {
+    threads.emplace_back(worker);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (auto& chunk : chunks) {
+    table->emplace_chunk(std::move(chunk));
+  }
+  return table;
+}
+
+// As in dbgen, only the first eight keys of every group of 32 are used
+int32_t order_key(const size_t order_index) { return static_cast<int32_t>(order_index / 8 * 32 + order_index % 8 + 1); }
+
+float retail_price(const int64_t part_key) {
+  return static_cast<float>(90000 + (part_key / 10) % 20001 + 100 * (part_key % 1000)) / 100.0f;
+}
+
+// the i-th of the four suppliers of a part
+int32_t part_supplier(const int64_t part_key, const int64_t supplier_index, const int64_t supplier_count) {
+  return static_cast<int32_t>(
+      (part_key + supplier_index * (supplier_count / 4 + (part_key - 1) / supplier_count)) % supplier_count + 1);
+}
+
+struct TpchCardinalities {
+  size_t supplier_count;
+  size_t customer_count;
+  size_t part_count;
+  size_t order_count;
+};
+
+// The attributes of an order that its line items depend on. They are drawn first from the order's random stream.
+struct OrderHeader {
+  int32_t customer_key;
+  int32_t order_date;
+  int32_t line_count;
+};
+
+OrderHeader order_header(RowRandom& random, const TpchCardinalities& cardinalities) {
+  auto header = OrderHeader{};
+  header.customer_key = static_cast<int32_t>(random.integer(1, cardinalities.customer_count));
+  header.order_date = static_cast<int32_t>(random.integer(START_DATE, END_DATE - 151));
+  header.line_count = static_cast<int32_t>(random.integer(1, 7));
+  return header;
+}
+
+struct LineItem {
+  int32_t part_key;
+  int32_t supplier_key;
+  float quantity;
+  float extended_price;
+  float discount;
+  float tax;
+  int32_t ship_date;
+  int32_t commit_date;
+  int32_t receipt_date;
+  const char* return_flag;
+  const char* line_status;
+};
+
+LineItem line_item(RowRandom& random, const OrderHeader& header, const TpchCardinalities& cardinalities) {
+  auto item = LineItem{};
+  item.part_key = static_cast<int32_t>(random.integer(1, cardinalities.part_count));
+  item.supplier_key = part_supplier(item.part_key, random.integer(0, 3), cardinalities.supplier_count);
+  item.quantity = static_cast<float>(random.integer(1, 50));
+  item.extended_price = item.quantity * retail_price(item.part_key);
+  item.discount = random.decimal(0, 10);
+  item.tax = random.decimal(0, 8);
+  item.ship_date = header.order_date + static_cast<int32_t>(random.integer(1, 121));
+  item.commit_date = header.order_date + static_cast<int32_t>(random.integer(30, 90));
+  item.receipt_date = item.ship_date + static_cast<int32_t>(random.integer(1, 30));
+  const auto returned = random.integer(0, 1) == 0;
+  item.return_flag = item.receipt_date <= CURRENT_DATE ? (returned ? "R" : "A") : "N";
+  item.line_status = item.ship_date > CURRENT_DATE ? "O" : "F";
+  return item;
+}
+
+// line items are numbered from 1 to 7 within their order
+uint64_t line_item_row(const size_t order_index, const int32_t line_number) { return order_index * 8 + line_number; }
+
+}  // namespace
+
+TpchTableGenerator::TpchTableGenerator(const float scale_factor, const uint32_t chunk_size, const uint64_t seed,
+                                       const uint32_t thread_count)
+    : _scale_factor(scale_factor),
+      _chunk_size(chunk_size),
+      _seed(seed),
+      _thread_count(thread_count > 0 ? thread_count : std::max(std::thread::hardware_concurrency(), 1u)) {
+  Assert(scale_factor > 0.0f, "Scale factor has to be positive");
+  Assert(chunk_size > 0, "Chunk size has to be positive");
+  // The sparse order keys have to fit into an int
+  Assert(_scaled_row_count(1'500'000) / 8 * 32 < std::numeric_limits<int32_t>::max(), "Scale factor is too large");
+}
+
+std::shared_ptr<Table> TpchTableGenerator::generate_table(const TpchTable table) const {
+  switch (table) {
+    case TpchTable::Region:
+      return _generate_region();
+    case TpchTable::Nation:
+      return _generate_nation();
+    case TpchTable::Supplier:
+      return _generate_supplier();
+    case TpchTable::Customer:
+      return _generate_customer();
+    case TpchTable::Part:
+      return _generate_part();
+    case TpchTable::PartSupp:
+      return _generate_part_supp();
+    case TpchTable::Orders:
+      return _generate_orders();
+    case TpchTable::LineItem:
+      return _generate_line_item();
+  }
+  Fail("Unknown TPC-H table");
+  return nullptr;
+}
+
+std::map<std::string, std::shared_ptr<Table>> TpchTableGenerator::generate() const {
+  auto tables = std::map<std::string, std::shared_ptr<Table>>{};
+  for (const auto table : {TpchTable::Region, TpchTable::Nation, TpchTable::Supplier, TpchTable::Customer,
+                           TpchTable::Part, TpchTable::PartSupp, TpchTable::Orders, TpchTable::LineItem}) {
+    tables.emplace(table_name(table), generate_table(table));
+  }
+  return tables;
+}
+
+void TpchTableGenerator::generate_and_store() const {
+  for (auto& [name, table] : generate()) {  // NOLINT
+    StorageManager::get().add_table(name, table);
+  }
+}
+
+const std::string& TpchTableGenerator::table_name(const TpchTable table) {
+  static const auto names = std::array<std::string, 8>{"region", "nation",   "supplier", "customer",
+                                                       "part",   "partsupp", "orders",   "lineitem"};
+  return names[static_cast<size_t>(table)];
+}
+
+size_t TpchTableGenerator::_scaled_row_count(const size_t row_count_at_sf1) const {
+  return std::max(size_t{1}, static_cast<size_t>(std::llround(row_count_at_sf1 * static_cast<double>(_scale_factor))));
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_region() const {
+  using Builder = ChunkBuilder<int32_t, std::string, std::string>;
+  return generate_chunked_table<Builder>(
+      {"r_regionkey", "r_name", "r_comment"}, REGIONS.size(), _chunk_size, _thread_count,
+      [&](Builder& builder, const size_t begin_row, const size_t end_row) {
+        for (auto row = begin_row; row < end_row; ++row) {
+          auto random = RowRandom{_seed, TpchTable::Region, row};
+          builder.append(static_cast<int32_t>(row), REGIONS[row], random.text(31, 115));
+        }
+      });
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_nation() const {
+  using Builder = ChunkBuilder<int32_t, std::string, int32_t, std::string>;
+  return generate_chunked_table<Builder>(
+      {"n_nationkey", "n_name", "n_regionkey", "n_comment"}, NATIONS.size(), _chunk_size, _thread_count,
+      [&](Builder& builder, const size_t begin_row, const size_t end_row) {
+        for (auto row = begin_row; row < end_row; ++row) {
+          auto random = RowRandom{_seed, TpchTable::Nation, row};
+          builder.append(static_cast<int32_t>(row), NATIONS[row].first, NATIONS[row].second, random.text(31, 114));
+        }
+      });
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_supplier() const {
+  using Builder = ChunkBuilder<int32_t, std::string, std::string, int32_t, std::string, float, std::string>;
+  return generate_chunked_table<Builder>(
+      {"s_suppkey", "s_name", "s_address", "s_nationkey", "s_phone", "s_acctbal", "s_comment"},
+      _scaled_row_count(10'000), _chunk_size, _thread_count,
+      [&](Builder& builder, const size_t begin_row, const size_t end_row) {
+        for (auto row = begin_row; row < end_row; ++row) {
+          auto random = RowRandom{_seed, TpchTable::Supplier, row};
+          const auto key = static_cast<int32_t>(row + 1);
+          auto address = random.alphanumeric(10, 40);
+          const auto nation_key = static_cast<int32_t>(random.integer(0, 24));
+          auto phone = random.phone(nation_key);
+          const auto account_balance = random.decimal(-99'999, 999'999);
+          builder.append(key, numbered_name("Supplier", key), std::move(address), nation_key, std::move(phone),
+                         account_balance, random.text(25, 100));
+        }
+      });
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_customer() const {
+  using Builder =
+      ChunkBuilder<int32_t, std::string, std::string, int32_t, std::string, float, std::string, std::string>;
+  return generate_chunked_table<Builder>(
+      {"c_custkey", "c_name", "c_address", "c_nationkey", "c_phone", "c_acctbal", "c_mktsegment", "c_comment"},
+      _scaled_row_count(150'000), _chunk_size, _thread_count,
+      [&](Builder& builder, const size_t begin_row, const size_t end_row) {
+        for (auto row = begin_row; row < end_row; ++row) {
+          auto random = RowRandom{_seed, TpchTable::Customer, row};
+          const auto key = static_cast<int32_t>(row + 1);
+          auto address = random.alphanumeric(10, 40);
+          const auto nation_key = static_cast<int32_t>(random.integer(0, 24));
+          auto phone = random.phone(nation_key);
+          const auto account_balance = random.decimal(-99'999, 999'999);
+          const auto* const segment = random.pick(SEGMENTS);
+          builder.append(key, numbered_name("Customer", key), std::move(address), nation_key, std::move(phone),
+                         account_balance, segment, random.text(29, 116));
+        }
+      });
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_part() const {
+  using Builder = ChunkBuilder<int32_t, std::string, std::string, std::string, std::string, int32_t, std::string,
+                               float, std::string>;
+  return generate_chunked_table<Builder>(
+      {"p_partkey", "p_name", "p_mfgr", "p_brand", "p_type", "p_size", "p_container", "p_retailprice", "p_comment"},
+      _scaled_row_count(200'000), _chunk_size, _thread_count,
+      [&](Builder& builder, const size_t begin_row, const size_t end_row) {
+        for (auto row = begin_row; row < end_row; ++row) {
+          auto random = RowRandom{_seed, TpchTable::Part, row};
+          const auto key = static_cast<int32_t>(row + 1);
+
+          auto name = std::string(random.pick(COLORS));
+          for (auto word_index = 1; word_index < 5; ++word_index) {
+            name += ' ';
+            name += random.pick(COLORS);
+          }
+
+          const auto manufacturer = random.integer(1, 5);
+          const auto brand = "Brand#" + std::to_string(manufacturer * 10 + random.integer(1, 5));
+          auto type = std::string(random.pick(TYPE_SYLLABLES_1)) + ' ' + random.pick(TYPE_SYLLABLES_2) + ' ' +
+                      random.pick(TYPE_SYLLABLES_3);
+          const auto size = static_cast<int32_t>(random.integer(1, 50));
+          auto container = std::string(random.pick(CONTAINER_SYLLABLES_1)) + ' ' + random.pick(CONTAINER_SYLLABLES_2);
+
+          builder.append(key, std::move(name), "Manufacturer#" + std::to_string(manufacturer), brand, std::move(type),
+                         size, std::move(container), retail_price(key), random.text(5, 22));
+        }
+      });
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_part_supp() const {
+  const auto supplier_count = _scaled_row_count(10'000);
+
+  using Builder = ChunkBuilder<int32_t, int32_t, int32_t, float, std::string>;
+  return generate_chunked_table<Builder>(
+      {"ps_partkey", "ps_suppkey", "ps_availqty", "ps_supplycost", "ps_comment"}, _scaled_row_count(200'000) * 4,
+      _chunk_size, _thread_count, [&](Builder& builder, const size_t begin_row, const size_t end_row) {
+        for (auto row = begin_row; row < end_row; ++row) {
+          auto random = RowRandom{_seed, TpchTable::PartSupp, row};
+          const auto part_key = static_cast<int32_t>(row / 4 + 1);
+          const auto available_quantity = static_cast<int32_t>(random.integer(1, 9'999));
+          const auto supply_cost = random.decimal(100, 100'000);
+          builder.append(part_key, part_supplier(part_key, row % 4, supplier_count), available_quantity, supply_cost,
+                         random.text(49, 198));
+        }
+      });
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_orders() const {
+  const auto cardinalities = TpchCardinalities{_scaled_row_count(10'000), _scaled_row_count(150'000),
+                                               _scaled_row_count(200'000), _scaled_row_count(1'500'000)};
+  const auto clerk_count = _scaled_row_count(1'000);
+
+  using Builder = ChunkBuilder<int32_t, int32_t, std::string, float, std::string, std::string, std::string, int32_t,
+                               std::string>;
+  return generate_chunked_table<Builder>(
+      {"o_orderkey", "o_custkey", "o_orderstatus", "o_totalprice", "o_orderdate", "o_orderpriority", "o_clerk",
+       "o_shippriority", "o_comment"},
+      cardinalities.order_count, _chunk_size, _thread_count,
+      [&](Builder& builder, const size_t begin_row, const size_t end_row) {
+        for (auto row = begin_row; row < end_row; ++row) {
+          auto random = RowRandom{_seed, TpchTable::Orders, row};
+          const auto header = order_header(random, cardinalities);
+
+          // The status and the total price are derived from the line items, which are regenerated here
+          auto total_price = 0.0;
+          auto open_line_count = 0;
+          for (auto line_number = 1; line_number <= header.line_count; ++line_number) {
+            auto line_random = RowRandom{_seed, TpchTable::LineItem, line_item_row(row, line_number)};
+            const auto item = line_item(line_random, header, cardinalities);
+            total_price += static_cast<double>(item.extended_price) * (1.0 + item.tax) * (1.0 - item.discount);
+            open_line_count += *item.line_status == 'O';
+          }
+          const auto* const status =
+              open_line_count == header.line_count ? "O" : (open_line_count == 0 ? "F" : "P");
+
+          const auto* const priority = random.pick(PRIORITIES);
+          auto clerk = numbered_name("Clerk", random.integer(1, clerk_count));
+          builder.append(order_key(row), header.customer_key, status, static_cast<float>(total_price),
+                         date_to_string(header.order_date), priority, std::move(clerk), 0, random.text(19, 78));
+        }
+      });
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_line_item() const {
+  const auto cardinalities = TpchCardinalities{_scaled_row_count(10'000), _scaled_row_count(150'000),
+                                               _scaled_row_count(200'000), _scaled_row_count(1'500'000)};
+
+  // Every order has one to seven line items. To be able to generate full chunks independently from each other, we
+  // first compute the position of every order's first line item.
+  auto order_offsets = std::vector<size_t>(cardinalities.order_count + 1);
+  for (auto order_index = size_t{0}; order_index < cardinalities.order_count; ++order_index) {
+    auto random = RowRandom{_seed, TpchTable::Orders, order_index};
+    order_offsets[order_index + 1] = order_offsets[order_index] + order_header(random, cardinalities).line_count;
+  }
+
+  using Builder = ChunkBuilder<int32_t, int32_t, int32_t, int32_t, float, float, float, float, std::string,
+                               std::string, std::string, std::string, std::string, std::string, std::string,
+                               std::string>;
+  return generate_chunked_table<Builder>(
+      {"l_orderkey", "l_partkey", "l_suppkey", "l_linenumber", "l_quantity", "l_extendedprice", "l_discount", "l_tax",
+       "l_returnflag", "l_linestatus", "l_shipdate", "l_commitdate", "l_receiptdate", "l_shipinstruct", "l_shipmode",
+       "l_comment"},
+      order_offsets.back(), _chunk_size, _thread_count,
+      [&](Builder& builder, const size_t begin_row, const size_t end_row) {
+        auto order_index = static_cast<size_t>(
+            std::upper_bound(order_offsets.begin(), order_offsets.end(), begin_row) - order_offsets.begin() - 1);
+        auto order_random = RowRandom{_seed, TpchTable::Orders, order_index};
+        auto header = order_header(order_random, cardinalities);
+
+        for (auto row = begin_row; row < end_row; ++row) {
+          if (row == order_offsets[order_index + 1]) {
+            ++order_index;
+            order_random = RowRandom{_seed, TpchTable::Orders, order_index};
+            header = order_header(order_random, cardinalities);
+          }
+          const auto line_number = static_cast<int32_t>(row - order_offsets[order_index] + 1);
+
+          auto random = RowRandom{_seed, TpchTable::LineItem, line_item_row(order_index, line_number)};
+          const auto item = line_item(random, header, cardinalities);
+          const auto* const ship_instruction = random.pick(SHIP_INSTRUCTIONS);
+          const auto* const ship_mode = random.pick(SHIP_MODES);
+          builder.append(order_key(order_index), item.part_key, item.supplier_key, line_number, item.quantity,
+                         item.extended_price, item.discount, item.tax, item.return_flag, item.line_status,
+                         date_to_string(item.ship_date), date_to_string(item.commit_date),
+                         date_to_string(item.receipt_date), ship_instruction, ship_mode, random.text(10, 43));
+        }
+      });
+}
+
+}  // namespace opossum
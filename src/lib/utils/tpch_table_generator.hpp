@@ -0,0 +1,59 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class TpchTable : uint8_t { Region, Nation, Supplier, Customer, Part, PartSupp, Orders, LineItem };
+
+// Generates the eight tables of the TPC-H schema in process, so that benchmarks and tests do not depend on dbgen or
+// on .tbl files. The data follows the shape of the TPC-H specification (cardinalities, key relationships, value
+// domains, date and price derivations), but it is not bit-identical to dbgen and must not be used for audited runs.
+//
+// Every value is derived from (seed, table, row) only, so the result is reproducible for a given seed, independent
+// of the chunk size and of the number of threads. Chunks are generated in parallel and their columns are built
+// directly as ValueSegments, i.e., without going through AllTypeVariant.
+//
+// Integers are stored as int, decimals as float, and dates as "YYYY-MM-DD" strings.
+class TpchTableGenerator {
+ public:
+  // scale_factor 1 corresponds to 6M lineitems. thread_count 0 uses one thread per hardware thread.
+  explicit TpchTableGenerator(const float scale_factor, const uint32_t chunk_size = 100'000, const uint64_t seed = 0,
+                              const uint32_t thread_count = 0);
+
+  std::shared_ptr<Table> generate_table(const TpchTable table) const;
+
+  // returns all tables by their TPC-H name, e.g., "lineitem"
+  std::map<std::string, std::shared_ptr<Table>> generate() const;
+
+  // generates all tables and adds them to the StorageManager
+  void generate_and_store() const;
+
+  static const std::string& table_name(const TpchTable table);
+
+ protected:
+  // number of rows for tables whose size grows linearly with the scale factor
+  size_t _scaled_row_count(const size_t row_count_at_sf1) const;
+
+  std::shared_ptr<Table> _generate_region() const;
+  std::shared_ptr<Table> _generate_nation() const;
+  std::shared_ptr<Table> _generate_supplier() const;
+  std::shared_ptr<Table> _generate_customer() const;
+  std::shared_ptr<Table> _generate_part() const;
+  std::shared_ptr<Table> _generate_part_supp() const;
+  std::shared_ptr<Table> _generate_orders() const;
+  std::shared_ptr<Table> _generate_line_item() const;
+
+  const float _scale_factor;
+  const uint32_t _chunk_size;
+  const uint64_t _seed;
+  const uint32_t _thread_count;
+};
+
+}  // namespace opossum
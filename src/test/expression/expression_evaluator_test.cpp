@@ -0,0 +1,188 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/expression/arithmetic_expression.hpp"
+#include "../lib/expression/case_expression.hpp"
+#include "../lib/expression/column_expression.hpp"
+#include "../lib/expression/comparison_expression.hpp"
+#include "../lib/expression/expression_evaluator.hpp"
+#include "../lib/expression/logical_expression.hpp"
+#include "../lib/expression/value_expression.hpp"
+#include "../lib/operators/sort.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/type_cast.hpp"
+
+namespace opossum {
+
+class ExpressionEvaluatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "long");
+    _table->add_column("c", "float");
+    _table->add_column("s", "string");
+    _table->append({1, int64_t{10}, 0.5f, "x"});
+    _table->append({2, int64_t{-20}, -1.5f, "y"});
+    _table->append({3, int64_t{30}, 2.0f, "x"});
+    _table->append({4, int64_t{40}, -0.5f, "z"});
+    _table->append({5, int64_t{-50}, 4.0f, "x"});
+    _table->compress_chunk(ChunkID{1});
+  }
+
+  static std::shared_ptr<AbstractExpression> _column(const uint16_t column_id) {
+    return std::make_shared<ColumnExpression>(ColumnID{column_id});
+  }
+
+  static std::shared_ptr<AbstractExpression> _value(const AllTypeVariant& value) {
+    return std::make_shared<ValueExpression>(value);
+  }
+
+  static std::shared_ptr<AbstractExpression> _arithmetic(const ArithmeticOperator arithmetic_operator,
+                                                         const std::shared_ptr<AbstractExpression>& left,
+                                                         const std::shared_ptr<AbstractExpression>& right) {
+    return std::make_shared<ArithmeticExpression>(arithmetic_operator, left, right);
+  }
+
+  static std::shared_ptr<AbstractExpression> _compare(const ScanType scan_type,
+                                                      const std::shared_ptr<AbstractExpression>& left,
+                                                      const std::shared_ptr<AbstractExpression>& right) {
+    return std::make_shared<ComparisonExpression>(scan_type, left, right);
+  }
+
+  // evaluates an expression on all chunks of a table
+  template <typename T>
+  static std::vector<T> _evaluate(const std::shared_ptr<const Table>& table, const AbstractExpression& expression) {
+    auto values = std::vector<T>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto segment = ExpressionEvaluator{table, chunk_id}.evaluate_to_segment(expression);
+      EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<T>>(segment));
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+        values.push_back(type_cast<T>((*segment)[chunk_offset]));
+      }
+    }
+    return values;
+  }
+
+  // returns the rows of a table (counted across chunks) for which a predicate is true
+  static std::vector<size_t> _select(const std::shared_ptr<const Table>& table, const AbstractExpression& expression) {
+    auto rows = std::vector<size_t>{};
+    auto chunk_begin = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      for (const auto chunk_offset : ExpressionEvaluator{table, chunk_id}.evaluate_to_selection(expression)) {
+        rows.push_back(chunk_begin + chunk_offset);
+      }
+      chunk_begin += table->get_chunk(chunk_id).size();
+    }
+    return rows;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ExpressionEvaluatorTest, Arithmetic) {
+  // a * b + c
+  const auto expression = _arithmetic(ArithmeticOperator::Addition,
+                                      _arithmetic(ArithmeticOperator::Multiplication, _column(0), _column(1)),
+                                      _column(2));
+  EXPECT_EQ(expression->data_type(*_table), DataType::Float);
+  EXPECT_EQ(expression->description(*_table), "(a * b) + c");
+  EXPECT_EQ(_evaluate<float>(_table, *expression), (std::vector<float>{10.5f, -41.5f, 92.0f, 159.5f, -246.0f}));
+
+  const auto difference = _arithmetic(ArithmeticOperator::Subtraction, _column(0), _value(int64_t{1}));
+  EXPECT_EQ(difference->data_type(*_table), DataType::Long);
+  EXPECT_EQ(_evaluate<int64_t>(_table, *difference), (std::vector<int64_t>{0, 1, 2, 3, 4}));
+
+  const auto quotient = _arithmetic(ArithmeticOperator::Division, _column(1), _column(0));
+  EXPECT_EQ(_evaluate<int64_t>(_table, *quotient), (std::vector<int64_t>{10, -10, 10, 10, -10}));
+
+  const auto double_quotient = _arithmetic(ArithmeticOperator::Division, _column(0), _value(2.0));
+  EXPECT_EQ(double_quotient->data_type(*_table), DataType::Double);
+  EXPECT_EQ(_evaluate<double>(_table, *double_quotient), (std::vector<double>{0.5, 1.0, 1.5, 2.0, 2.5}));
+
+  const auto division_by_zero = _arithmetic(ArithmeticOperator::Division, _column(0), _value(0));
+  EXPECT_THROW(_evaluate<int32_t>(_table, *division_by_zero), std::exception);
+
+  const auto string_arithmetic = _arithmetic(ArithmeticOperator::Addition, _column(3), _value(1));
+  EXPECT_THROW(string_arithmetic->data_type(*_table), std::exception);
+}
+
+TEST_F(ExpressionEvaluatorTest, Predicates) {
+  // (a > 1 AND s = 'x') OR c < 0
+  const auto conjunction = std::make_shared<LogicalExpression>(
+      LogicalOperator::And, _compare(ScanType::OpGreaterThan, _column(0), _value(1)),
+      _compare(ScanType::OpEquals, _column(3), _value("x")));
+  const auto expression = std::make_shared<LogicalExpression>(LogicalOperator::Or, conjunction,
+                                                              _compare(ScanType::OpLessThan, _column(2), _value(0)));
+  EXPECT_EQ(expression->description(*_table), "((a > 1) AND (s = 'x')) OR (c < 0)");
+  EXPECT_EQ(_select(_table, *expression), (std::vector<size_t>{1, 2, 3, 4}));
+  EXPECT_EQ(_evaluate<int32_t>(_table, *expression), (std::vector<int32_t>{0, 1, 1, 1, 1}));
+
+  // Numbers of different types are compared in their common type, numbers are true unless they are 0
+  EXPECT_EQ(_select(_table, *_compare(ScanType::OpLessThanEquals, _column(2), _column(0))),
+            (std::vector<size_t>{0, 1, 2, 3, 4}));
+  EXPECT_EQ(_select(_table, *_arithmetic(ArithmeticOperator::Subtraction, _column(0), _value(3))),
+            (std::vector<size_t>{0, 1, 3, 4}));
+
+  EXPECT_THROW(_select(_table, *_compare(ScanType::OpEquals, _column(3), _value(1))), std::exception);
+  EXPECT_THROW(_select(_table, *_column(3)), std::exception);
+}
+
+TEST_F(ExpressionEvaluatorTest, Case) {
+  // CASE WHEN a > 3 THEN s ELSE 'small' END
+  const auto string_case =
+      std::make_shared<CaseExpression>(_compare(ScanType::OpGreaterThan, _column(0), _value(3)), _column(3),
+                                       _value("small"));
+  EXPECT_EQ(string_case->data_type(*_table), DataType::String);
+  EXPECT_EQ(_evaluate<std::string>(_table, *string_case),
+            (std::vector<std::string>{"small", "small", "small", "z", "x"}));
+
+  // CASE WHEN c < 0 THEN 0 ELSE b / a END, which only divides the rows for which it is needed
+  const auto numeric_case = std::make_shared<CaseExpression>(
+      _compare(ScanType::OpLessThan, _column(2), _value(0.0f)), _value(0),
+      _arithmetic(ArithmeticOperator::Division, _column(1), _column(0)));
+  EXPECT_EQ(numeric_case->data_type(*_table), DataType::Long);
+  EXPECT_EQ(_evaluate<int64_t>(_table, *numeric_case), (std::vector<int64_t>{10, 0, 10, 0, -10}));
+
+  const auto mixed_case = std::make_shared<CaseExpression>(_column(0), _column(3), _column(0));
+  EXPECT_THROW(mixed_case->data_type(*_table), std::exception);
+}
+
+TEST_F(ExpressionEvaluatorTest, ReferenceSegmentsAndBatches) {
+  auto table = std::make_shared<Table>(5'000);
+  table->add_column("a", "int");
+  for (auto row = int32_t{0}; row < 7'000; ++row) table->append({row});
+  table->compress_chunk(ChunkID{0});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto sort =
+      std::make_shared<Sort>(table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Descending}});
+  sort->execute();
+
+  // a % 3 = 0, computed as a - (a / 3) * 3 = 0
+  const auto remainder = _arithmetic(
+      ArithmeticOperator::Subtraction, _column(0),
+      _arithmetic(ArithmeticOperator::Multiplication,
+                  _arithmetic(ArithmeticOperator::Division, _column(0), _value(3)), _value(3)));
+  const auto rows = _select(sort->get_output(), *_compare(ScanType::OpEquals, remainder, _value(0)));
+  ASSERT_EQ(rows.size(), 2'334u);
+  for (auto index = size_t{0}; index < rows.size(); ++index) {
+    // The sorted output starts with 6999, which has a remainder of 0
+    EXPECT_EQ(rows[index], index * 3);
+  }
+
+  const auto values = _evaluate<int32_t>(sort->get_output(), *_arithmetic(ArithmeticOperator::Addition, _column(0),
+                                                                          _value(1)));
+  ASSERT_EQ(values.size(), 7'000u);
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    EXPECT_EQ(values[index], static_cast<int32_t>(7'000 - index));
+  }
+}
+
+}  // namespace opossum
@@ -73,4 +73,45 @@ TEST_F(AllTypeVariantTest, GetExtractsExactNumericalValue) {
   }
 }
 
+TEST_F(AllTypeVariantTest, TypeCastConvertsNumbers) {
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{int32_t{-17}}), -17);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{int64_t{17}}), 17);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{3.7}), 3);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{-3.7f}), -3);
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{int64_t{1} << 40}), 1099511627776.0);
+  EXPECT_EQ(type_cast<float>(AllTypeVariant{0.5}), 0.5f);
+}
+
+TEST_F(AllTypeVariantTest, TypeCastParsesAndPrintsStrings) {
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"42"}), 42);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"+42"}), 42);
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{"-3.5"}), -3);
+  EXPECT_EQ(type_cast<float>(AllTypeVariant{"458.7"}), 458.7f);
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{"1e3"}), 1000.0);
+
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{int64_t{-123456789012}}), "-123456789012");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{458.7f}), "458.7");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{0.1}), "0.1");
+  EXPECT_EQ(to_string(AllTypeVariant{3}), "3");
+}
+
+TEST_F(AllTypeVariantTest, TryTypeCastReportsErrors) {
+  auto int_value = int32_t{7};
+  EXPECT_EQ(try_type_cast(AllTypeVariant{"Hi"}, int_value), std::errc::invalid_argument);
+  EXPECT_EQ(try_type_cast(AllTypeVariant{"12abc"}, int_value), std::errc::invalid_argument);
+  EXPECT_EQ(try_type_cast(AllTypeVariant{""}, int_value), std::errc::invalid_argument);
+  EXPECT_EQ(try_type_cast(AllTypeVariant{int64_t{1} << 40}, int_value), std::errc::result_out_of_range);
+  EXPECT_EQ(try_type_cast(AllTypeVariant{1e20}, int_value), std::errc::result_out_of_range);
+  EXPECT_EQ(try_type_cast(AllTypeVariant{"99999999999"}, int_value), std::errc::result_out_of_range);
+  // failed conversions do not touch the result
+  EXPECT_EQ(int_value, 7);
+
+  auto float_value = float{};
+  EXPECT_EQ(try_type_cast(AllTypeVariant{1e300}, float_value), std::errc::result_out_of_range);
+  EXPECT_EQ(try_type_cast(AllTypeVariant{int32_t{3}}, float_value), std::errc());
+  EXPECT_EQ(float_value, 3.0f);
+
+  EXPECT_THROW(type_cast<double>(AllTypeVariant{"pi"}), std::exception);
+}
+
 }  // namespace opossum
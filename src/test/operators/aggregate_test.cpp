@@ -0,0 +1,285 @@
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/aggregate.hpp"
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_queue_scheduler.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(3);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "float");
+    table->append({1, "x", 1.5f});
+    table->append({2, "y", 2.0f});
+    table->append({1, "x", 3.5f});
+    table->append({2, "x", -1.0f});
+    table->append({1, "y", 4.0f});
+    table->append({3, "z", 0.5f});
+    table->append({1, "x", 2.0f});
+    _table = table;
+  }
+
+  void TearDown() override { CurrentScheduler::set(nullptr); }
+
+  std::shared_ptr<TableWrapper> _wrap(const std::shared_ptr<const Table>& table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  void _compress() {
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      _table->compress_chunk(chunk_id);
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsAggregateTest, GroupBySingleColumn) {
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("COUNT(*)", "long");
+  expected->add_column("SUM(c)", "double");
+  expected->add_column("MIN(c)", "float");
+  expected->add_column("MAX(b)", "string");
+  expected->add_column("AVG(c)", "double");
+  expected->append({1, int64_t{4}, 11.0, 1.5f, "y", 2.75});
+  expected->append({2, int64_t{2}, 1.0, -1.0f, "y", 0.5});
+  expected->append({3, int64_t{1}, 0.5, 0.5f, "z", 0.5});
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count},
+                                                                 {ColumnID{2}, AggregateFunction::Sum},
+                                                                 {ColumnID{2}, AggregateFunction::Min},
+                                                                 {ColumnID{1}, AggregateFunction::Max},
+                                                                 {ColumnID{2}, AggregateFunction::Avg}};
+
+  auto aggregate = std::make_shared<Aggregate>(_wrap(_table), aggregates, std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+
+  // Group keys on DictionarySegments are aggregated by their ValueIDs
+  _compress();
+  auto dictionary_aggregate =
+      std::make_shared<Aggregate>(_wrap(_table), aggregates, std::vector<ColumnID>{ColumnID{0}});
+  dictionary_aggregate->execute();
+  EXPECT_TABLE_EQ(dictionary_aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, GroupByValueIDs) {
+  // Few distinct values use the SIMD histogram, more use the scalar ones of the different attribute vector widths
+  for (const auto distinct_value_count : {5, 16, 200, 1'000}) {
+    auto table = std::make_shared<Table>(10'007);
+    table->add_column("key", "int");
+    table->add_column("value", "int");
+    for (auto row = 0; row < 30'000; ++row) {
+      table->append({(row * 31) % distinct_value_count, row % 17});
+    }
+
+    const auto aggregates = std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count},
+                                                                   {ColumnID{1}, AggregateFunction::Sum},
+                                                                   {ColumnID{1}, AggregateFunction::Max}};
+    auto expected = std::make_shared<Aggregate>(_wrap(table), aggregates, std::vector<ColumnID>{ColumnID{0}});
+    expected->execute();
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      table->compress_chunk(chunk_id);
+    }
+    auto aggregate = std::make_shared<Aggregate>(_wrap(table), aggregates, std::vector<ColumnID>{ColumnID{0}});
+    aggregate->execute();
+
+    EXPECT_EQ(aggregate->get_output()->row_count(), static_cast<uint64_t>(distinct_value_count));
+    EXPECT_TABLE_EQ(aggregate->get_output(), expected->get_output());
+  }
+}
+
+TEST_F(OperatorsAggregateTest, GroupBySharedDictionary) {
+  CurrentScheduler::set(std::make_shared<TaskQueueScheduler>(4));
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("key", "string");
+  table->add_column("value", "int");
+  for (auto row = 0; row < 10'000; ++row) {
+    // Every chunk holds a different subset of the keys
+    table->append({std::to_string((row * 7) % (30 + row / 1'000)), row % 13});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->compress_chunk(chunk_id);
+  }
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count},
+                                                                 {ColumnID{1}, AggregateFunction::Sum},
+                                                                 {ColumnID{1}, AggregateFunction::Min}};
+  auto expected = std::make_shared<Aggregate>(_wrap(table), aggregates, std::vector<ColumnID>{ColumnID{0}});
+  expected->execute();
+
+  table->share_dictionaries(ColumnID{0});
+  auto aggregate = std::make_shared<Aggregate>(_wrap(table), aggregates, std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  EXPECT_EQ(aggregate->get_output()->row_count(), 39u);
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected->get_output());
+}
+
+TEST_F(OperatorsAggregateTest, GroupByMultipleColumns) {
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "string");
+  expected->add_column("a", "int");
+  expected->add_column("SUM(a)", "long");
+  expected->add_column("MAX(c)", "float");
+  expected->append({"x", 1, int64_t{3}, 3.5f});
+  expected->append({"y", 2, int64_t{2}, 2.0f});
+  expected->append({"x", 2, int64_t{2}, -1.0f});
+  expected->append({"y", 1, int64_t{1}, 4.0f});
+  expected->append({"z", 3, int64_t{3}, 0.5f});
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Sum},
+                                                                 {ColumnID{2}, AggregateFunction::Max}};
+  const auto group_by_column_ids = std::vector<ColumnID>{ColumnID{1}, ColumnID{0}};
+
+  // Compress only the first chunk, so that ValueIDs and values are mixed
+  _table->compress_chunk(ChunkID{0});
+  auto aggregate = std::make_shared<Aggregate>(_wrap(_table), aggregates, group_by_column_ids);
+  aggregate->execute();
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, WithoutGroupBy) {
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Count},
+                                                                 {ColumnID{0}, AggregateFunction::Sum},
+                                                                 {ColumnID{1}, AggregateFunction::Min}};
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("COUNT(a)", "long");
+  expected->add_column("SUM(a)", "long");
+  expected->add_column("MIN(b)", "string");
+  expected->append({int64_t{7}, int64_t{11}, "x"});
+
+  auto aggregate = std::make_shared<Aggregate>(_wrap(_table), aggregates, std::vector<ColumnID>{});
+  aggregate->execute();
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected, true);
+
+  // An empty input still results in a single row
+  auto empty_table = std::make_shared<Table>();
+  empty_table->add_column("a", "int");
+  empty_table->add_column("b", "string");
+
+  auto expected_empty = std::make_shared<Table>();
+  expected_empty->add_column("COUNT(a)", "long");
+  expected_empty->add_column("SUM(a)", "long");
+  expected_empty->add_column("MIN(b)", "string");
+  expected_empty->append({int64_t{0}, int64_t{0}, ""});
+
+  auto empty_aggregate = std::make_shared<Aggregate>(_wrap(empty_table), aggregates, std::vector<ColumnID>{});
+  empty_aggregate->execute();
+  EXPECT_TABLE_EQ(empty_aggregate->get_output(), expected_empty, true);
+
+  // ... while a grouped aggregate over an empty input is empty
+  auto grouped_empty_aggregate =
+      std::make_shared<Aggregate>(_wrap(empty_table), aggregates, std::vector<ColumnID>{ColumnID{1}});
+  grouped_empty_aggregate->execute();
+  EXPECT_EQ(grouped_empty_aggregate->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsAggregateTest, ReferenceInput) {
+  auto keys = std::make_shared<Table>();
+  keys->add_column("key", "int");
+  keys->append({1});
+  keys->append({3});
+
+  // Only the rows of _table with a in (1, 3) remain
+  auto join = std::make_shared<JoinHash>(_wrap(_table), _wrap(keys), std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "string");
+  expected->add_column("COUNT(*)", "long");
+  expected->add_column("MIN(a)", "int");
+  expected->append({"x", int64_t{3}, 1});
+  expected->append({"y", int64_t{1}, 1});
+  expected->append({"z", int64_t{1}, 3});
+
+  auto aggregate = std::make_shared<Aggregate>(
+      join,
+      std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count},
+                                             {ColumnID{0}, AggregateFunction::Min}},
+      std::vector<ColumnID>{ColumnID{1}});
+  aggregate->execute();
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, ParallelPartitions) {
+  CurrentScheduler::set(std::make_shared<TaskQueueScheduler>(4));
+
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("key", "long");
+  table->add_column("name", "string");
+  table->add_column("value", "double");
+
+  auto expected_values = std::map<std::pair<int64_t, std::string>, std::tuple<int64_t, double, double>>{};
+  for (auto row = int64_t{0}; row < 20'000; ++row) {
+    const auto key = (row * 7919) % 503;
+    const auto name = std::string(1, static_cast<char>('a' + row % 3));
+    const auto value = static_cast<double>(row % 101) - 50.0;
+    table->append({key, name, value});
+
+    auto [iter, inserted] = expected_values.try_emplace({key, name}, 0, 0.0, value);  // NOLINT
+    auto& [count, sum, max] = iter->second;  // NOLINT
+    ++count;
+    sum += value;
+    max = std::max(max, value);
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); chunk_id += 2) {
+    table->compress_chunk(chunk_id);
+  }
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("key", "long");
+  expected->add_column("name", "string");
+  expected->add_column("COUNT(value)", "long");
+  expected->add_column("AVG(value)", "double");
+  expected->add_column("MAX(value)", "double");
+  for (const auto& [group, aggregates] : expected_values) {  // NOLINT
+    const auto& [count, sum, max] = aggregates;  // NOLINT
+    expected->append({group.first, group.second, count, sum / count, max});
+  }
+
+  auto aggregate =
+      std::make_shared<Aggregate>(_wrap(table),
+                                  std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Count},
+                                                                         {ColumnID{2}, AggregateFunction::Avg},
+                                                                         {ColumnID{2}, AggregateFunction::Max}},
+                                  std::vector<ColumnID>{ColumnID{0}, ColumnID{1}});
+  aggregate->execute();
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, ThrowsOnInvalidAggregates) {
+  const auto group_by_column_ids = std::vector<ColumnID>{ColumnID{0}};
+  auto sum_of_strings = std::make_shared<Aggregate>(
+      _wrap(_table), std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}},
+      group_by_column_ids);
+  EXPECT_THROW(sum_of_strings->execute(), std::exception);
+
+  auto max_without_column = std::make_shared<Aggregate>(
+      _wrap(_table), std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Max}},
+      group_by_column_ids);
+  EXPECT_THROW(max_without_column->execute(), std::exception);
+}
+
+}  // namespace opossum
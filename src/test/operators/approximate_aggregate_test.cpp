@@ -0,0 +1,113 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/approximate_aggregate.hpp"
+#include "../lib/operators/table_sample.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsApproximateAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 100 chunks of 1'000 rows in two groups. The values grow with the chunks, so that the chunks differ.
+    auto table = std::make_shared<Table>(1'000);
+    table->add_column("group", "string");
+    table->add_column("value", "int");
+    for (auto row = 0; row < 100'000; ++row) {
+      table->append({std::string{row % 2 == 0 ? "a" : "b"}, row / 1'000 + row % 10});
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<const Table> _aggregate(const double chunk_fraction, const double row_fraction) {
+    auto sample = std::make_shared<TableSample>(_table_wrapper, chunk_fraction, row_fraction, 1);
+    sample->execute();
+    auto aggregate = std::make_shared<ApproximateAggregate>(sample, _aggregates, std::vector<ColumnID>{ColumnID{0}});
+    aggregate->execute();
+    return aggregate->get_output();
+  }
+
+  // Checks that the estimate of the output column lies within its error of the exact value
+  static void _expect_within_error(const Table& output, const size_t row, const ColumnID column_id,
+                                   const double exact_value) {
+    const auto& chunk = output.get_chunk(ChunkID{0});
+    const auto estimate = type_cast<double>((*chunk.get_segment(column_id))[row]);
+    const auto error = type_cast<double>((*chunk.get_segment(ColumnID{static_cast<uint16_t>(column_id + 1)}))[row]);
+    EXPECT_GT(error, 0.0);
+    EXPECT_NEAR(estimate, exact_value, error);
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  const std::vector<AggregateColumnDefinition> _aggregates = {{std::nullopt, AggregateFunction::Count},
+                                                              {ColumnID{1}, AggregateFunction::Sum},
+                                                              {ColumnID{1}, AggregateFunction::Avg}};
+};
+
+TEST_F(OperatorsApproximateAggregateTest, ExactForFullSample) {
+  const auto output = _aggregate(1.0, 1.0);
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("group", "string");
+  for (const auto& name : std::vector<std::string>{"COUNT(*)", "SUM(value)", "AVG(value)"}) {
+    expected->add_column(name, "double");
+    expected->add_column(name + " ERROR", "double");
+  }
+  expected->append({"a", 50'000.0, 0.0, 2'675'000.0, 0.0, 53.5, 0.0});
+  expected->append({"b", 50'000.0, 0.0, 2'725'000.0, 0.0, 54.5, 0.0});
+  EXPECT_TABLE_EQ(output, expected);
+}
+
+TEST_F(OperatorsApproximateAggregateTest, EstimatesWithinError) {
+  const auto output = _aggregate(0.3, 0.2);
+  ASSERT_EQ(output->row_count(), 2u);
+  const auto& groups = *output->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  for (auto row = size_t{0}; row < 2; ++row) {
+    const auto is_a = type_cast<std::string>(groups[ChunkOffset{static_cast<uint32_t>(row)}]) == "a";
+    _expect_within_error(*output, row, ColumnID{1}, 50'000.0);
+    _expect_within_error(*output, row, ColumnID{3}, is_a ? 2'675'000.0 : 2'725'000.0);
+    _expect_within_error(*output, row, ColumnID{5}, is_a ? 53.5 : 54.5);
+  }
+}
+
+TEST_F(OperatorsApproximateAggregateTest, EmptyInput) {
+  auto table = std::make_shared<Table>();
+  table->add_column("group", "string");
+  table->add_column("value", "int");
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto sample = std::make_shared<TableSample>(table_wrapper, 0.5);
+  sample->execute();
+  auto aggregate = std::make_shared<ApproximateAggregate>(
+      sample,
+      std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count},
+                                             {ColumnID{1}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{});
+  aggregate->execute();
+
+  // The totals of an empty input are exact
+  auto expected = std::make_shared<Table>();
+  for (const auto& name : std::vector<std::string>{"COUNT(*)", "SUM(value)"}) {
+    expected->add_column(name, "double");
+    expected->add_column(name + " ERROR", "double");
+  }
+  expected->append({0.0, 0.0, 0.0, 0.0});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsApproximateAggregateTest, ThrowsOnMinMax) {
+  auto sample = std::make_shared<TableSample>(_table_wrapper, 0.5);
+  EXPECT_THROW(std::make_shared<ApproximateAggregate>(
+                   sample, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Min}},
+                   std::vector<ColumnID>{}),
+               std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/resolve_type.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/type_cast.hpp"
+
+namespace opossum {
+
+// Shared fixture of the join tests, which compare the joins with a nested loop join
+class BaseJoinTest : public BaseTest {
+ protected:
+  void TearDown() override { CurrentScheduler::set(nullptr); }
+
+  // creates a table with an id column and a key column of the given type. key(row) returns the key of a row.
+  template <typename KeyFunction>
+  static std::shared_ptr<TableWrapper> _create_table(const std::string& type, const size_t row_count,
+                                                     const uint32_t chunk_size, const bool compress,
+                                                     const KeyFunction& key) {
+    auto table = std::make_shared<Table>(chunk_size);
+    table->add_column("id", "int");
+    table->add_column("key", type);
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      table->append({static_cast<int32_t>(row), key(row)});
+    }
+    if (compress) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->compress_chunk(chunk_id);
+      }
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // joins the key columns (ColumnID 1) of two tables from _create_table, whose keys are of type T, with a nested loop
+  // join
+  template <typename T>
+  static std::shared_ptr<Table> _expected_join(const Table& left, const Table& right,
+                                               const ScanType scan_type = ScanType::OpEquals) {
+    auto expected = std::make_shared<Table>();
+    for (const auto* table : {&left, &right}) {
+      for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+        expected->add_column(table->column_name(column_id), table->column_type(column_id));
+      }
+    }
+
+    const auto rows = [](const Table& table) {
+      auto rows = std::vector<std::pair<AllTypeVariant, T>>{};
+      for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+        const auto& chunk = table.get_chunk(chunk_id);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+          rows.emplace_back((*chunk.get_segment(ColumnID{0}))[chunk_offset],
+                            type_cast<T>((*chunk.get_segment(ColumnID{1}))[chunk_offset]));
+        }
+      }
+      return rows;
+    };
+
+    resolve_scan_type(scan_type, [&](const auto& comparator) {
+      for (const auto& [left_id, left_key] : rows(left)) {  // NOLINT
+        for (const auto& [right_id, right_key] : rows(right)) {  // NOLINT
+          if (comparator(left_key, right_key)) expected->append({left_id, left_key, right_id, right_key});
+        }
+      }
+    });
+    return expected;
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/get_table.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsGetTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _test_table = std::make_shared<Table>(2);
+    StorageManager::get().add_table("aNiceTestTable", _test_table);
+  }
+
+  std::shared_ptr<Table> _test_table;
+};
+
+TEST_F(OperatorsGetTableTest, GetOutput) {
+  auto gt = std::make_shared<GetTable>("aNiceTestTable");
+  EXPECT_EQ(gt->get_output(), nullptr);
+  gt->execute();
+
+  EXPECT_EQ(gt->get_output()->max_chunk_size(), _test_table->max_chunk_size());
+  EXPECT_EQ(gt->table_name(), "aNiceTestTable");
+  EXPECT_EQ(gt->name(), "GetTable");
+}
+
+TEST_F(OperatorsGetTableTest, OutputIsSnapshot) {
+  _test_table->add_column("col_1", "int");
+  _test_table->append({1});
+  auto gt = std::make_shared<GetTable>("aNiceTestTable");
+  gt->execute();
+
+  // Rows that are appended after the execution are not part of the output
+  _test_table->append({2});
+  _test_table->append({3});
+  EXPECT_EQ(gt->get_output()->row_count(), 1u);
+  EXPECT_EQ(_test_table->row_count(), 3u);
+}
+
+TEST_F(OperatorsGetTableTest, ThrowsUnknownTableName) {
+  auto gt = std::make_shared<GetTable>("anUglyTestTable");
+
+  EXPECT_THROW(gt->execute(), std::exception);
+}
+
+TEST_F(OperatorsGetTableTest, CannotBeExecutedTwice) {
+  auto gt = std::make_shared<GetTable>("aNiceTestTable");
+  gt->execute();
+
+  EXPECT_THROW(gt->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,135 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_join_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/scheduler/task_queue_scheduler.hpp"
+#include "../lib/storage/reference_segment.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseJoinTest {
+ protected:
+  void _test_join(const std::string& type, const bool compress) {
+    resolve_data_type(data_type_from_string(type), [&](auto data_type) {
+      using Type = typename decltype(data_type)::type;
+      const auto left = _create_table(type, 300, 70, compress, [](const size_t row) {
+        return type_cast<Type>(static_cast<int32_t>(row % 40));
+      });
+      const auto right = _create_table(type, 200, 30, compress, [](const size_t row) {
+        return type_cast<Type>(static_cast<int32_t>(row * 7 % 60));
+      });
+
+      auto join = std::make_shared<JoinHash>(left, right, std::make_pair(ColumnID{1}, ColumnID{1}));
+      join->execute();
+      EXPECT_TABLE_EQ(join->get_output(), _expected_join<Type>(*left->get_output(), *right->get_output()));
+    });
+  }
+};
+
+TEST_F(OperatorsJoinHashTest, JoinsAllDataTypes) {
+  for (const auto& type : {"int", "long", "float", "double", "string"}) {
+    _test_join(type, false);
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, JoinsDictionarySegments) {
+  for (const auto& type : {"int", "long", "float", "double", "string"}) {
+    _test_join(type, true);
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, OutputReferencesInputs) {
+  const auto left = _create_table("int", 10, 4, false, [](const size_t row) { return static_cast<int32_t>(row); });
+  const auto right = _create_table("int", 5, 4, true, [](const size_t row) { return static_cast<int32_t>(row * 2); });
+
+  auto join = std::make_shared<JoinHash>(left, right, std::make_pair(ColumnID{1}, ColumnID{1}));
+  join->execute();
+
+  const auto& output = *join->get_output();
+  EXPECT_EQ(output.row_count(), 5u);
+  EXPECT_EQ(output.column_names(), (std::vector<std::string>{"id", "key", "id", "key"}));
+
+  const auto& chunk = output.get_chunk(ChunkID{0});
+  const auto left_segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk.get_segment(ColumnID{0}));
+  const auto right_segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk.get_segment(ColumnID{3}));
+  ASSERT_TRUE(left_segment && right_segment);
+  EXPECT_EQ(left_segment->referenced_table(), left->get_output());
+  EXPECT_EQ(right_segment->referenced_table(), right->get_output());
+  EXPECT_EQ(right_segment->referenced_column_id(), ColumnID{1});
+  // All columns of one input share their position list
+  EXPECT_EQ(left_segment->pos_list(),
+            std::static_pointer_cast<ReferenceSegment>(chunk.get_segment(ColumnID{1}))->pos_list());
+}
+
+TEST_F(OperatorsJoinHashTest, JoinsReferenceSegments) {
+  const auto a = _create_table("int", 50, 8, false, [](const size_t row) { return static_cast<int32_t>(row % 10); });
+  const auto b = _create_table("int", 30, 8, true, [](const size_t row) { return static_cast<int32_t>(row % 15); });
+  const auto c = _create_table("int", 20, 8, false, [](const size_t row) { return static_cast<int32_t>(row % 5); });
+
+  auto join_ab = std::make_shared<JoinHash>(a, b, std::make_pair(ColumnID{1}, ColumnID{1}));
+  join_ab->execute();
+  auto join_abc = std::make_shared<JoinHash>(join_ab, c, std::make_pair(ColumnID{3}, ColumnID{1}));
+  join_abc->execute();
+
+  // Joining the reference table must give the same result as joining a copy of its data
+  auto expected_input = _expected_join<int32_t>(*a->get_output(), *b->get_output());
+  EXPECT_TABLE_EQ(join_ab->get_output(), expected_input);
+  auto wrapped_input = std::make_shared<TableWrapper>(expected_input);
+  wrapped_input->execute();
+  auto expected = std::make_shared<JoinHash>(wrapped_input, c, std::make_pair(ColumnID{3}, ColumnID{1}));
+  expected->execute();
+  EXPECT_TABLE_EQ(join_abc->get_output(), expected->get_output());
+
+  // The output of the second join references the data tables, not the output of the first join
+  const auto segment = std::dynamic_pointer_cast<ReferenceSegment>(
+      join_abc->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  EXPECT_EQ(segment->referenced_table(), a->get_output());
+}
+
+TEST_F(OperatorsJoinHashTest, SkewedInputsInParallel) {
+  CurrentScheduler::set(std::make_shared<TaskQueueScheduler>(4));
+
+  // The build side is large enough to be partitioned, and one of its keys occurs 20 times. On the probe side, the
+  // same key occurs in more rows than a single probe job handles.
+  const auto build = _create_table("int", 30'000, 10'000, false, [](const size_t row) {
+    return static_cast<int32_t>(row < 20 ? 0 : row);
+  });
+  const auto probe = _create_table("int", 80'000, 10'000, true, [](const size_t row) {
+    return static_cast<int32_t>(row % 10 == 0 ? row : 0);
+  });
+
+  auto join = std::make_shared<JoinHash>(probe, build, std::make_pair(ColumnID{1}, ColumnID{1}));
+  join->execute();
+
+  // Key 0 occurs in 72'001 probe rows (including row 0) and 20 build rows. The other probe keys are the multiples of
+  // 10, which match once if they are in [20, 30'000).
+  EXPECT_EQ(join->get_output()->row_count(), 72'001u * 20u + 2'998u);
+}
+
+TEST_F(OperatorsJoinHashTest, EmptyInput) {
+  const auto left = _create_table("string", 0, 10, false, [](const size_t row) { return std::to_string(row); });
+  const auto right = _create_table("string", 10, 10, false, [](const size_t row) { return std::to_string(row); });
+
+  auto join = std::make_shared<JoinHash>(left, right, std::make_pair(ColumnID{1}, ColumnID{1}));
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 0u);
+  EXPECT_EQ(join->get_output()->column_count(), 4u);
+}
+
+TEST_F(OperatorsJoinHashTest, ThrowsOnUnsupportedJoins) {
+  const auto ints = _create_table("int", 10, 10, false, [](const size_t row) { return static_cast<int32_t>(row); });
+  const auto longs = _create_table("long", 10, 10, false, [](const size_t row) { return static_cast<int64_t>(row); });
+
+  EXPECT_THROW(std::make_shared<JoinHash>(ints, longs, std::make_pair(ColumnID{1}, ColumnID{1}))->execute(),
+               std::exception);
+  EXPECT_THROW(std::make_shared<JoinHash>(ints, ints, std::make_pair(ColumnID{1}, ColumnID{1}), ScanType::OpLessThan)
+                   ->execute(),
+               std::exception);
+}
+
+}  // namespace opossum
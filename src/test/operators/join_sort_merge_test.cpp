@@ -0,0 +1,91 @@
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_join_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_sort_merge.hpp"
+#include "../lib/scheduler/task_queue_scheduler.hpp"
+
+namespace opossum {
+
+class OperatorsJoinSortMergeTest : public BaseJoinTest {
+ protected:
+  void _test_join(const std::string& type, const bool compress) {
+    resolve_data_type(data_type_from_string(type), [&](auto data_type) {
+      using Type = typename decltype(data_type)::type;
+      const auto left = _create_table(type, 60, 25, compress, [](const size_t row) {
+        return type_cast<Type>(static_cast<int32_t>(row * 13 % 40));
+      });
+      const auto right = _create_table(type, 45, 10, !compress, [](const size_t row) {
+        return type_cast<Type>(static_cast<int32_t>(row * 7 % 50));
+      });
+
+      for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                   ScanType::OpLessThanEquals, ScanType::OpGreaterThan,
+                                   ScanType::OpGreaterThanEquals}) {
+        auto join = std::make_shared<JoinSortMerge>(left, right, std::make_pair(ColumnID{1}, ColumnID{1}), scan_type);
+        join->execute();
+        EXPECT_TABLE_EQ(join->get_output(),
+                        _expected_join<Type>(*left->get_output(), *right->get_output(), scan_type));
+      }
+    });
+  }
+};
+
+TEST_F(OperatorsJoinSortMergeTest, JoinsAllDataTypesAndScanTypes) {
+  for (const auto& type : {"int", "long", "float", "double", "string"}) {
+    _test_join(type, false);
+    _test_join(type, true);
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, JoinsInParallelPartitions) {
+  CurrentScheduler::set(std::make_shared<TaskQueueScheduler>(4));
+  for (const auto& type : {"int", "string"}) {
+    _test_join(type, false);
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, UsesSortedChunks) {
+  // Chunks that are flagged as sorted are not sorted again
+  const auto left = _create_table("int", 100, 30, false, [](const size_t row) { return static_cast<int32_t>(row); });
+  const auto right = _create_table("int", 50, 20, true, [](const size_t row) { return static_cast<int32_t>(row * 3); });
+  for (const auto& table : {left->get_output(), right->get_output()}) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      std::const_pointer_cast<Table>(table)->get_chunk(chunk_id).set_ordered_by(ColumnID{1});
+    }
+  }
+
+  auto join = std::make_shared<JoinSortMerge>(left, right, std::make_pair(ColumnID{1}, ColumnID{1}),
+                                              ScanType::OpLessThanEquals);
+  join->execute();
+  EXPECT_TABLE_EQ(join->get_output(),
+                  _expected_join<int32_t>(*left->get_output(), *right->get_output(), ScanType::OpLessThanEquals));
+
+  // The flag is trusted, so a wrong flag leads to wrong results. Debug builds detect it.
+  if (IS_DEBUG) {
+    const auto unsorted =
+        _create_table("int", 10, 10, false, [](const size_t row) { return static_cast<int32_t>(10 - row); });
+    std::const_pointer_cast<Table>(unsorted->get_output())->get_chunk(ChunkID{0}).set_ordered_by(ColumnID{1});
+    auto wrong_join = std::make_shared<JoinSortMerge>(unsorted, right, std::make_pair(ColumnID{1}, ColumnID{1}),
+                                                      ScanType::OpEquals);
+    EXPECT_THROW(wrong_join->execute(), std::exception);
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, EmptyInput) {
+  const auto left = _create_table("int", 0, 10, false, [](const size_t row) { return static_cast<int32_t>(row); });
+  const auto right = _create_table("int", 10, 10, false, [](const size_t row) { return static_cast<int32_t>(row); });
+
+  auto join = std::make_shared<JoinSortMerge>(left, right, std::make_pair(ColumnID{1}, ColumnID{1}),
+                                              ScanType::OpNotEquals);
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 0u);
+  EXPECT_EQ(join->get_output()->column_count(), 4u);
+}
+
+}  // namespace opossum
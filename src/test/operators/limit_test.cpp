@@ -0,0 +1,73 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/limit.hpp"
+#include "../lib/operators/sort.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsLimitTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(2);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->append({5, "e"});
+    table->append({3, "c"});
+    table->append({4, "d"});
+    table->append({1, "a"});
+    table->append({2, "b"});
+    table->compress_chunk(ChunkID{1});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsLimitTest, EmitsFirstRows) {
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  expected->append({5, "e"});
+  expected->append({3, "c"});
+  expected->append({4, "d"});
+
+  auto limit = std::make_shared<Limit>(_table_wrapper, 3);
+  limit->execute();
+  EXPECT_TABLE_EQ(limit->get_output(), expected, true);
+}
+
+TEST_F(OperatorsLimitTest, ReferenceInput) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}});
+  sort->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  expected->append({1, "a"});
+  expected->append({2, "b"});
+
+  auto limit = std::make_shared<Limit>(sort, 2);
+  limit->execute();
+  EXPECT_TABLE_EQ(limit->get_output(), expected, true);
+}
+
+TEST_F(OperatorsLimitTest, ZeroAndTooManyRows) {
+  auto zero_limit = std::make_shared<Limit>(_table_wrapper, 0);
+  zero_limit->execute();
+  EXPECT_EQ(zero_limit->get_output()->row_count(), 0u);
+  EXPECT_EQ(zero_limit->get_output()->column_count(), 2u);
+
+  auto large_limit = std::make_shared<Limit>(_table_wrapper, 100);
+  large_limit->execute();
+  EXPECT_TABLE_EQ(large_limit->get_output(), _table_wrapper->get_output(), true);
+}
+
+}  // namespace opossum
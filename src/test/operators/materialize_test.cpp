@@ -0,0 +1,156 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/aggregate.hpp"
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/limit.hpp"
+#include "../lib/operators/materialize.hpp"
+#include "../lib/operators/sort.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/segment_iterate.hpp"
+#include "../lib/storage/string_heap_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class OperatorsMaterializeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Every other chunk is dictionary-encoded
+    _table = std::make_shared<Table>(100);
+    _table->add_column("id", "int");
+    _table->add_column("key", "int");
+    _table->add_column("name", "string");
+    for (auto row = int32_t{0}; row < 1'000; ++row) {
+      _table->append({row, (row * 7'919) % 211, "name" + std::to_string(row % 17)});
+    }
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); chunk_id += 2) {
+      _table->compress_chunk(chunk_id);
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  static void _expect_data_segments(const Table& table) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+        EXPECT_FALSE(std::dynamic_pointer_cast<ReferenceSegment>(table.get_chunk(chunk_id).get_segment(column_id)));
+      }
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsMaterializeTest, ClusteredPositions) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{1}}});
+  sort->execute();
+
+  auto materialize = std::make_shared<Materialize>(sort);
+  materialize->execute();
+
+  const auto& output = materialize->get_output();
+  EXPECT_TABLE_EQ(output, sort->get_output(), true);
+  _expect_data_segments(*output);
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).ordered_by(), ColumnID{1});
+}
+
+TEST_F(OperatorsMaterializeTest, ScatteredPositions) {
+  auto keys = std::make_shared<Table>(7);
+  keys->add_column("key", "int");
+  for (auto key = int32_t{210}; key >= 0; key -= 3) keys->append({key});
+  auto keys_wrapper = std::make_shared<TableWrapper>(keys);
+  keys_wrapper->execute();
+
+  auto join = std::make_shared<JoinHash>(keys_wrapper, _table_wrapper, std::make_pair(ColumnID{0}, ColumnID{1}));
+  join->execute();
+  ASSERT_GT(join->get_output()->row_count(), 0u);
+
+  auto materialize = std::make_shared<Materialize>(join);
+  materialize->execute();
+
+  const auto& output = materialize->get_output();
+  EXPECT_TABLE_EQ(output, join->get_output(), true);
+  _expect_data_segments(*output);
+}
+
+TEST_F(OperatorsMaterializeTest, DictionaryOutput) {
+  // The first 50 rows all lie in the first chunk, which is dictionary-encoded
+  auto limit = std::make_shared<Limit>(_table_wrapper, 50);
+  limit->execute();
+
+  auto materialize = std::make_shared<Materialize>(limit);
+  materialize->execute();
+
+  const auto& output = materialize->get_output();
+  EXPECT_TABLE_EQ(output, limit->get_output(), true);
+
+  // The value ids of the int columns need four bytes, as there are more than 256 distinct values in the table.
+  // However, the chunk only has 100 distinct ids, so they fit into one byte.
+  const auto& input_chunk = _table->get_chunk(ChunkID{0});
+  const auto& output_chunk = output->get_chunk(ChunkID{0});
+  const auto id_segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(output_chunk.get_segment(ColumnID{0}));
+  ASSERT_TRUE(id_segment);
+  EXPECT_EQ(id_segment->dictionary(),
+            std::static_pointer_cast<DictionarySegment<int32_t>>(input_chunk.get_segment(ColumnID{0}))->dictionary());
+  const auto name_segment =
+      std::dynamic_pointer_cast<DictionarySegment<std::string>>(output_chunk.get_segment(ColumnID{2}));
+  ASSERT_TRUE(name_segment);
+  EXPECT_EQ(name_segment->size(), 50u);
+
+  // The shared dictionary contains values that the output does not refer to, which must not show up as groups
+  auto aggregate = std::make_shared<Aggregate>(
+      materialize, std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+  EXPECT_EQ(aggregate->get_output()->row_count(), 50u);
+}
+
+TEST_F(OperatorsMaterializeTest, DataInput) {
+  auto materialize = std::make_shared<Materialize>(_table_wrapper);
+  materialize->execute();
+
+  const auto& output = materialize->get_output();
+  ASSERT_EQ(output->chunk_count(), _table->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& input_segment = _table->get_chunk(chunk_id).get_segment(ColumnID{2});
+    EXPECT_EQ(output->get_chunk(chunk_id).get_segment(ColumnID{2}), input_segment);
+  }
+}
+
+TEST_F(OperatorsMaterializeTest, SegmentMaterializeStringHeap) {
+  for (const auto use_inline_headers : {true, false}) {
+    auto segment = std::make_shared<StringHeapSegment>(use_inline_headers);
+    for (auto row = 0; row < 100; ++row) segment->append_string(std::string(row % 13, 'x') + std::to_string(row));
+
+    auto table = std::make_shared<Table>();
+    table->add_column("s", "string");
+    auto chunk = Chunk{};
+    chunk.add_segment(segment);
+    table->emplace_chunk(std::move(chunk));
+
+    auto pos_list = std::make_shared<PosList>();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 100; chunk_offset += 3) {
+      pos_list->push_back(RowID{ChunkID{0}, ChunkOffset{99 - chunk_offset}});
+    }
+    const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+
+    auto values = std::vector<std::string>(pos_list->size());
+    segment_materialize<std::string>(reference_segment, values.data());
+    for (auto index = size_t{0}; index < values.size(); ++index) {
+      EXPECT_EQ(values[index], segment->get((*pos_list)[index].chunk_offset));
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,144 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/expression/arithmetic_expression.hpp"
+#include "../lib/expression/column_expression.hpp"
+#include "../lib/expression/value_expression.hpp"
+#include "../lib/operators/aggregate.hpp"
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/pipeline_executor.hpp"
+#include "../lib/operators/projection.hpp"
+#include "../lib/operators/sort.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_queue_scheduler.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsPipelineExecutorTest : public BaseTest {
+ protected:
+  void TearDown() override { CurrentScheduler::set(nullptr); }
+
+  // creates a table with the columns id, key (with 50 distinct values) and name. Every other chunk is
+  // dictionary-encoded.
+  static std::shared_ptr<TableWrapper> _create_table(const size_t row_count, const uint32_t chunk_size) {
+    auto table = std::make_shared<Table>(chunk_size);
+    table->add_column("id", "int");
+    table->add_column("key", "long");
+    table->add_column("name", "string");
+    for (auto row = int32_t{0}; row < static_cast<int32_t>(row_count); ++row) {
+      table->append({row, int64_t{(row * 7'919) % 50}, "name" + std::to_string(row % 7)});
+    }
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); chunk_id += 2) {
+      table->compress_chunk(chunk_id);
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  static std::shared_ptr<AbstractExpression> _column(const uint16_t column_id) {
+    return std::make_shared<ColumnExpression>(ColumnID{column_id});
+  }
+
+  // SELECT name, key * 2 + id AS value FROM table WHERE key > 10 AND id < limit, followed by an operator on top
+  template <typename Consumer>
+  static std::shared_ptr<AbstractOperator> _create_plan(const std::shared_ptr<TableWrapper>& table_wrapper,
+                                                        const int32_t limit, const Consumer& consumer) {
+    auto key_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpGreaterThan, 10);
+    auto id_scan = std::make_shared<TableScan>(key_scan, ColumnID{0}, ScanType::OpLessThan, limit);
+    const auto value = std::make_shared<ArithmeticExpression>(
+        ArithmeticOperator::Addition,
+        std::make_shared<ArithmeticExpression>(ArithmeticOperator::Multiplication, _column(1),
+                                               std::make_shared<ValueExpression>(int64_t{2})),
+        _column(0));
+    auto projection =
+        std::make_shared<Projection>(id_scan, std::vector<std::shared_ptr<AbstractExpression>>{_column(2), value});
+    return consumer(projection);
+  }
+
+  // executes the operators of a plan one by one
+  static void _execute_operators(const std::shared_ptr<AbstractOperator>& op) {
+    if (op->get_output()) return;
+    if (op->input_left()) _execute_operators(op->input_left());
+    if (op->input_right()) _execute_operators(op->input_right());
+    op->execute();
+  }
+
+  template <typename Consumer>
+  static void _expect_same_result(const std::shared_ptr<TableWrapper>& table_wrapper, const int32_t limit,
+                                  const Consumer& consumer, const bool order_sensitive) {
+    const auto expected_plan = _create_plan(table_wrapper, limit, consumer);
+    _execute_operators(expected_plan);
+
+    const auto plan = _create_plan(table_wrapper, limit, consumer);
+    const auto output = PipelineExecutor{plan}.execute();
+    EXPECT_EQ(output, plan->get_output());
+    EXPECT_TABLE_EQ(output, expected_plan->get_output(), order_sensitive);
+  }
+};
+
+TEST_F(OperatorsPipelineExecutorTest, FusedOperators) {
+  const auto table_wrapper = _create_table(1'000, 100);
+  _expect_same_result(table_wrapper, 500, [](const auto& projection) { return projection; }, true);
+
+  // Filters out everything
+  _expect_same_result(table_wrapper, -1, [](const auto& projection) { return projection; }, true);
+}
+
+TEST_F(OperatorsPipelineExecutorTest, Aggregate) {
+  const auto aggregate = [](const std::shared_ptr<AbstractOperator>& projection) {
+    return std::make_shared<Aggregate>(
+        projection,
+        std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum},
+                                               {std::nullopt, AggregateFunction::Count}},
+        std::vector<ColumnID>{ColumnID{0}});
+  };
+
+  const auto table_wrapper = _create_table(1'000, 100);
+  _expect_same_result(table_wrapper, 500, aggregate, false);
+  _expect_same_result(table_wrapper, 1'000, aggregate, false);
+
+  // Without group by columns, an empty input still results in one row
+  _expect_same_result(table_wrapper, -1, [](const std::shared_ptr<AbstractOperator>& projection) {
+    return std::make_shared<Aggregate>(
+        projection, std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count}},
+        std::vector<ColumnID>{});
+  }, true);
+}
+
+TEST_F(OperatorsPipelineExecutorTest, PipelineBreakers) {
+  const auto table_wrapper = _create_table(1'000, 100);
+  const auto keys = _create_table(20, 10);
+
+  // The join consumes one pipeline on each side, and the sort consumes the output of the join
+  _expect_same_result(table_wrapper, 800, [&](const std::shared_ptr<AbstractOperator>& projection) {
+    auto key_scan = std::make_shared<TableScan>(keys, ColumnID{0}, ScanType::OpLessThan, 10);
+    auto join = std::make_shared<JoinHash>(projection, key_scan, std::make_pair(ColumnID{0}, ColumnID{2}));
+    return std::make_shared<Sort>(join, std::vector<SortColumnDefinition>{{ColumnID{1}}, {ColumnID{3}}});
+  }, true);
+}
+
+TEST_F(OperatorsPipelineExecutorTest, MorselsAndWorkers) {
+  CurrentScheduler::set(std::make_shared<TaskQueueScheduler>(4));
+
+  // The second chunk is larger than a morsel
+  const auto morsel_size = size_t{PipelineExecutor::MORSEL_SIZE};
+  const auto table_wrapper = _create_table(morsel_size + 20'000, static_cast<uint32_t>(morsel_size + 10'000));
+  _expect_same_result(table_wrapper, 70'000, [](const auto& projection) { return projection; }, false);
+  _expect_same_result(table_wrapper, 70'000, [](const std::shared_ptr<AbstractOperator>& projection) {
+    return std::make_shared<Aggregate>(
+        projection, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Max}},
+        std::vector<ColumnID>{ColumnID{0}});
+  }, false);
+}
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/print.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsPrintTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsPrintTest, PrintsTable) {
+  auto output = std::ostringstream{};
+  auto print = std::make_shared<Print>(_table_wrapper, output);
+  print->execute();
+
+  EXPECT_EQ(print->get_output(), _table_wrapper->get_output());
+  EXPECT_EQ(output.str(),
+            "=== Columns\n"
+            "|       a|       b|\n"
+            "|     int|   float|\n"
+            "=== Chunk 0 === \n"
+            "|   12345|   458.7|\n"
+            "|     123|   456.7|\n"
+            "=== Chunk 1 === \n"
+            "|    1234|   457.7|\n");
+}
+
+TEST_F(OperatorsPrintTest, PrintsEmptyChunk) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a_long_column_name", "string");
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto output = std::ostringstream{};
+  auto print = std::make_shared<Print>(table_wrapper, output);
+  print->execute();
+
+  EXPECT_EQ(output.str(),
+            "=== Columns\n"
+            "|a_long_column_name|\n"
+            "|            string|\n"
+            "=== Chunk 0 === \n"
+            "Empty chunk.\n");
+}
+
+}  // namespace opossum
@@ -0,0 +1,126 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/expression/arithmetic_expression.hpp"
+#include "../lib/expression/case_expression.hpp"
+#include "../lib/expression/column_expression.hpp"
+#include "../lib/expression/comparison_expression.hpp"
+#include "../lib/expression/value_expression.hpp"
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/projection.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/type_cast.hpp"
+
+namespace opossum {
+
+class OperatorsProjectionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "double");
+    _table->add_column("s", "string");
+    _table->append({1, 1.5, "one"});
+    _table->append({2, -2.0, "two"});
+    _table->append({3, 0.25, "three"});
+    _table->compress_chunk(ChunkID{0});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  static std::shared_ptr<AbstractExpression> _column(const uint16_t column_id) {
+    return std::make_shared<ColumnExpression>(ColumnID{column_id});
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsProjectionTest, ComputedColumns) {
+  // SELECT s, a * b + 1, CASE WHEN a >= 2 THEN s ELSE 'small' END
+  const auto expressions = std::vector<std::shared_ptr<AbstractExpression>>{
+      _column(2),
+      std::make_shared<ArithmeticExpression>(
+          ArithmeticOperator::Addition,
+          std::make_shared<ArithmeticExpression>(ArithmeticOperator::Multiplication, _column(0), _column(1)),
+          std::make_shared<ValueExpression>(1)),
+      std::make_shared<CaseExpression>(std::make_shared<ComparisonExpression>(ScanType::OpGreaterThanEquals, _column(0),
+                                                                              std::make_shared<ValueExpression>(2)),
+                                       _column(2), std::make_shared<ValueExpression>("small"))};
+  auto projection = std::make_shared<Projection>(_table_wrapper, expressions);
+  projection->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("s", "string");
+  expected->add_column("(a * b) + 1", "double");
+  expected->add_column("CASE WHEN a >= 2 THEN s ELSE 'small' END", "string");
+  expected->append({"one", 2.5, "small"});
+  expected->append({"two", -3.0, "two"});
+  expected->append({"three", 1.75, "three"});
+
+  const auto& output = projection->get_output();
+  EXPECT_TABLE_EQ(output, expected, true);
+  EXPECT_EQ(output->chunk_count(), 2u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ReferenceSegment>(output->get_chunk(ChunkID{0}).get_segment(ColumnID{0})));
+}
+
+TEST_F(OperatorsProjectionTest, ForwardsReferenceSegments) {
+  auto keys = std::make_shared<Table>();
+  keys->add_column("a", "int");
+  keys->append({3});
+  keys->append({1});
+  auto keys_wrapper = std::make_shared<TableWrapper>(keys);
+  keys_wrapper->execute();
+
+  auto join = std::make_shared<JoinHash>(_table_wrapper, keys_wrapper, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  // SELECT b, a, a - 1
+  const auto expressions = std::vector<std::shared_ptr<AbstractExpression>>{
+      _column(1), _column(0),
+      std::make_shared<ArithmeticExpression>(ArithmeticOperator::Subtraction, _column(0),
+                                             std::make_shared<ValueExpression>(1))};
+  auto projection = std::make_shared<Projection>(join, expressions);
+  projection->execute();
+
+  const auto& output = projection->get_output();
+  const auto& input = join->get_output();
+  ASSERT_EQ(output->chunk_count(), input->chunk_count());
+  auto row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& output_chunk = output->get_chunk(chunk_id);
+    const auto& input_chunk = input->get_chunk(chunk_id);
+    EXPECT_EQ(output_chunk.get_segment(ColumnID{0}), input_chunk.get_segment(ColumnID{1}));
+    EXPECT_EQ(output_chunk.get_segment(ColumnID{1}), input_chunk.get_segment(ColumnID{0}));
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < output_chunk.size(); ++chunk_offset) {
+      EXPECT_EQ((*output_chunk.get_segment(ColumnID{2}))[chunk_offset],
+                AllTypeVariant{type_cast<int32_t>((*output_chunk.get_segment(ColumnID{1}))[chunk_offset]) - 1});
+      ++row_count;
+    }
+  }
+  EXPECT_EQ(row_count, 2u);
+}
+
+TEST_F(OperatorsProjectionTest, InvalidExpressions) {
+  const auto division_by_zero = std::make_shared<ArithmeticExpression>(ArithmeticOperator::Division, _column(0),
+                                                                       std::make_shared<ValueExpression>(0));
+  auto projection =
+      std::make_shared<Projection>(_table_wrapper, std::vector<std::shared_ptr<AbstractExpression>>{division_by_zero});
+  EXPECT_THROW(projection->execute(), std::exception);
+
+  const auto string_arithmetic =
+      std::make_shared<ArithmeticExpression>(ArithmeticOperator::Addition, _column(2), _column(0));
+  projection =
+      std::make_shared<Projection>(_table_wrapper, std::vector<std::shared_ptr<AbstractExpression>>{string_arithmetic});
+  EXPECT_THROW(projection->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/sort.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/resolve_type.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_queue_scheduler.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/type_cast.hpp"
+
+namespace opossum {
+
+class OperatorsSortTest : public BaseTest {
+ protected:
+  void TearDown() override { CurrentScheduler::set(nullptr); }
+
+  static std::shared_ptr<TableWrapper> _wrap(const std::shared_ptr<const Table>& table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // creates a table with an id column, a key column of the given type and a second int key column with few distinct
+  // values. Every other chunk is dictionary-encoded.
+  template <typename T>
+  static std::shared_ptr<Table> _create_table(const size_t row_count, const uint32_t chunk_size) {
+    auto table = std::make_shared<Table>(chunk_size);
+    table->add_column("id", "int");
+    table->add_column("key", data_type_to_string(data_type_of<T>));
+    table->add_column("key2", "int");
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      const auto number = static_cast<int32_t>((row * 7'919) % 211) - 105;
+      auto key = AllTypeVariant{};
+      if constexpr (std::is_same_v<T, std::string>) {
+        key = std::string(static_cast<size_t>(number + 106) % 7, 'a') + std::to_string(number);
+      } else {
+        key = static_cast<T>(number) / static_cast<T>(4);
+      }
+      table->append({static_cast<int32_t>(row), key, static_cast<int32_t>(row % 3)});
+    }
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); chunk_id += 2) {
+      table->compress_chunk(chunk_id);
+    }
+    return table;
+  }
+
+  // sorts the rows of a table with std::stable_sort
+  template <typename T>
+  static std::shared_ptr<Table> _expected_sort(const Table& table,
+                                               const std::vector<SortColumnDefinition>& definitions) {
+    auto rows = std::vector<std::vector<AllTypeVariant>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+        auto row = std::vector<AllTypeVariant>{};
+        for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+          row.push_back((*chunk.get_segment(column_id))[chunk_offset]);
+        }
+        rows.push_back(row);
+      }
+    }
+
+    std::stable_sort(rows.begin(), rows.end(), [&](const auto& left, const auto& right) {
+      for (const auto& definition : definitions) {
+        const auto& left_value = left[definition.column_id];
+        const auto& right_value = right[definition.column_id];
+        if (left_value == right_value) continue;
+        const auto is_key_column = definition.column_id == ColumnID(1);
+        const auto is_less =
+            is_key_column ? type_cast<T>(left_value) < type_cast<T>(right_value) : left_value < right_value;
+        return definition.order_by_mode == OrderByMode::Ascending ? is_less : !is_less;
+      }
+      return false;
+    });
+
+    auto expected = std::make_shared<Table>();
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      expected->add_column(table.column_name(column_id), table.column_type(column_id));
+    }
+    for (const auto& row : rows) expected->append(row);
+    return expected;
+  }
+};
+
+TEST_F(OperatorsSortTest, AllTypes) {
+  for (const auto& type : {"int", "long", "float", "double", "string"}) {
+    resolve_data_type(type, [&](auto data_type) {
+      using T = typename decltype(data_type)::type;
+      const auto table = _create_table<T>(1'000, 300);
+
+      for (const auto& definitions : std::vector<std::vector<SortColumnDefinition>>{
+               {{ColumnID{1}, OrderByMode::Ascending}},
+               {{ColumnID{1}, OrderByMode::Descending}},
+               {{ColumnID{2}, OrderByMode::Descending}, {ColumnID{1}, OrderByMode::Ascending}},
+               {{ColumnID{1}, OrderByMode::Ascending}, {ColumnID{2}, OrderByMode::Descending}}}) {
+        auto sort = std::make_shared<Sort>(_wrap(table), definitions);
+        sort->execute();
+        EXPECT_TABLE_EQ(sort->get_output(), _expected_sort<T>(*table, definitions), true);
+      }
+    });
+  }
+}
+
+TEST_F(OperatorsSortTest, NegativeAndZeroNumbers) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("id", "int");
+  table->add_column("value", "double");
+  table->append({0, 1.5});
+  table->append({1, -0.0});
+  table->append({2, -2.5});
+  table->append({3, 0.0});
+  table->append({4, -1'000'000.0});
+  table->append({5, 3.0});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("id", "int");
+  expected->add_column("value", "double");
+  expected->append({4, -1'000'000.0});
+  expected->append({2, -2.5});
+  expected->append({1, -0.0});
+  expected->append({3, 0.0});
+  expected->append({0, 1.5});
+  expected->append({5, 3.0});
+
+  auto sort = std::make_shared<Sort>(_wrap(table), std::vector<SortColumnDefinition>{{ColumnID{1}}});
+  sort->execute();
+  EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+  EXPECT_EQ(sort->get_output()->get_chunk(ChunkID{0}).ordered_by(), ColumnID{1});
+}
+
+TEST_F(OperatorsSortTest, ReferenceInput) {
+  const auto table = _create_table<int32_t>(100, 30);
+  auto keys = std::make_shared<Table>();
+  keys->add_column("key2", "int");
+  keys->append({1});
+
+  // Only the rows with key2 = 1 remain
+  auto join = std::make_shared<JoinHash>(_wrap(table), _wrap(keys), std::make_pair(ColumnID{2}, ColumnID{0}));
+  join->execute();
+
+  // The order of the join output is not defined, so the sort needs to be unambiguous
+  const auto definitions =
+      std::vector<SortColumnDefinition>{{ColumnID{1}, OrderByMode::Descending}, {ColumnID{0}, OrderByMode::Ascending}};
+  auto sort = std::make_shared<Sort>(join, definitions);
+  sort->execute();
+
+  auto sort_of_sort = std::make_shared<Sort>(sort, std::vector<SortColumnDefinition>{{ColumnID{0}}});
+  sort_of_sort->execute();
+
+  auto expected_join = std::make_shared<Table>();
+  for (const auto& column_name : {"id", "key", "key2", "key2"}) expected_join->add_column(column_name, "int");
+  for (auto row = int32_t{1}; row < 100; row += 3) {
+    expected_join->append({row, ((row * 7'919) % 211 - 105) / 4, 1, 1});
+  }
+  EXPECT_TABLE_EQ(sort->get_output(), _expected_sort<int32_t>(*expected_join, definitions), true);
+  EXPECT_TABLE_EQ(sort_of_sort->get_output(), expected_join, true);
+  EXPECT_FALSE(sort->get_output()->get_chunk(ChunkID{0}).ordered_by());
+}
+
+TEST_F(OperatorsSortTest, ParallelMerge) {
+  CurrentScheduler::set(std::make_shared<TaskQueueScheduler>(4));
+
+  const auto table = _create_table<std::string>(5'000, 400);
+  const auto definitions = std::vector<SortColumnDefinition>{{ColumnID{1}, OrderByMode::Descending}};
+  auto sort = std::make_shared<Sort>(_wrap(table), definitions);
+  sort->execute();
+  EXPECT_TABLE_EQ(sort->get_output(), _expected_sort<std::string>(*table, definitions), true);
+}
+
+TEST_F(OperatorsSortTest, EmptyInput) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+
+  auto sort = std::make_shared<Sort>(_wrap(table), std::vector<SortColumnDefinition>{{ColumnID{0}}});
+  sort->execute();
+  EXPECT_EQ(sort->get_output()->row_count(), 0u);
+  EXPECT_EQ(sort->get_output()->column_count(), 1u);
+}
+
+}  // namespace opossum
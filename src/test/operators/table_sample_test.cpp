@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_sample.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsTableSampleTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 10 chunks of 1'000 rows, the value of a row is its index
+    auto table = std::make_shared<Table>(1'000);
+    table->add_column("a", "int");
+    for (auto row = 0; row < 10'000; ++row) table->append({row});
+    table->compress_chunk(ChunkID{3});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  // returns the values of all rows of a sample
+  static std::vector<int32_t> _values(const Table& table) {
+    auto values = std::vector<int32_t>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& segment = *table.get_chunk(chunk_id).get_segment(ColumnID{0});
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+        values.push_back(type_cast<int32_t>(segment[chunk_offset]));
+      }
+    }
+    return values;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTableSampleTest, SampleChunks) {
+  auto sample = std::make_shared<TableSample>(_table_wrapper, 0.3, 1.0, 7);
+  sample->execute();
+  const auto& output = *sample->get_output();
+
+  EXPECT_EQ(sample->input_chunk_count(), 10u);
+  EXPECT_EQ(sample->sampled_chunk_count(), 3u);
+  ASSERT_EQ(output.chunk_count(), 3u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ReferenceSegment>(output.get_chunk(ChunkID{0}).get_segment(ColumnID{0})));
+
+  // Every output chunk is a whole input chunk, in the order of the input
+  auto previous_first_value = -1;
+  for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto& segment = *output.get_chunk(chunk_id).get_segment(ColumnID{0});
+    ASSERT_EQ(segment.size(), 1'000u);
+    const auto first_value = type_cast<int32_t>(segment[ChunkOffset{0}]);
+    EXPECT_EQ(first_value % 1'000, 0);
+    EXPECT_GT(first_value, previous_first_value);
+    EXPECT_EQ(type_cast<int32_t>(segment[ChunkOffset{999}]), first_value + 999);
+    previous_first_value = first_value;
+  }
+}
+
+TEST_F(OperatorsTableSampleTest, SampleRows) {
+  auto sample = std::make_shared<TableSample>(_table_wrapper, 1.0, 0.1, 42);
+  sample->execute();
+  const auto values = _values(*sample->get_output());
+
+  EXPECT_EQ(sample->sampled_chunk_count(), 10u);
+  EXPECT_GT(values.size(), 800u);
+  EXPECT_LT(values.size(), 1'200u);
+  EXPECT_TRUE(std::is_sorted(values.cbegin(), values.cend()));
+  EXPECT_EQ(std::adjacent_find(values.cbegin(), values.cend()), values.cend());
+}
+
+TEST_F(OperatorsTableSampleTest, Reproducible) {
+  const auto sample_values = [&](const uint64_t seed) {
+    auto sample = std::make_shared<TableSample>(_table_wrapper, 0.5, 0.2, seed);
+    sample->execute();
+    return _values(*sample->get_output());
+  };
+
+  EXPECT_EQ(sample_values(1), sample_values(1));
+  EXPECT_NE(sample_values(1), sample_values(2));
+}
+
+TEST_F(OperatorsTableSampleTest, ReferenceInput) {
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 5'000);
+  table_scan->execute();
+
+  auto sample = std::make_shared<TableSample>(table_scan, 1.0, 0.5, 3);
+  sample->execute();
+  const auto values = _values(*sample->get_output());
+  ASSERT_FALSE(values.empty());
+  EXPECT_GE(*std::min_element(values.cbegin(), values.cend()), 5'000);
+
+  // The output references the data table, not the output of the scan
+  const auto segment = std::dynamic_pointer_cast<ReferenceSegment>(
+      sample->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), _table_wrapper->get_output());
+}
+
+TEST_F(OperatorsTableSampleTest, ThrowsOnInvalidFractions) {
+  EXPECT_THROW(std::make_shared<TableSample>(_table_wrapper, 0.0), std::exception);
+  EXPECT_THROW(std::make_shared<TableSample>(_table_wrapper, 0.5, 1.5), std::exception);
+}
+
+}  // namespace opossum
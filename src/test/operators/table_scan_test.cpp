@@ -0,0 +1,105 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(3);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->append({5, "e"});
+    table->append({3, "c"});
+    table->append({4, "d"});
+    table->append({1, "a"});
+    table->append({2, "b"});
+    table->append({3, "f"});
+    table->append({9, "g"});
+    table->compress_chunk(ChunkID{1});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  static std::shared_ptr<Table> _create_expected(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    auto expected = std::make_shared<Table>();
+    expected->add_column("a", "int");
+    expected->add_column("b", "string");
+    for (const auto& row : rows) expected->append(row);
+    return expected;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTableScanTest, ScanTypes) {
+  const auto scan = [&](const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value) {
+    auto table_scan = std::make_shared<TableScan>(_table_wrapper, column_id, scan_type, search_value);
+    table_scan->execute();
+    return table_scan->get_output();
+  };
+
+  EXPECT_TABLE_EQ(scan(ColumnID{0}, ScanType::OpEquals, 3), _create_expected({{3, "c"}, {3, "f"}}), true);
+  EXPECT_TABLE_EQ(scan(ColumnID{0}, ScanType::OpNotEquals, 3),
+                  _create_expected({{5, "e"}, {4, "d"}, {1, "a"}, {2, "b"}, {9, "g"}}), true);
+  EXPECT_TABLE_EQ(scan(ColumnID{0}, ScanType::OpLessThan, 3), _create_expected({{1, "a"}, {2, "b"}}), true);
+  EXPECT_TABLE_EQ(scan(ColumnID{0}, ScanType::OpGreaterThanEquals, 5), _create_expected({{5, "e"}, {9, "g"}}), true);
+  EXPECT_TABLE_EQ(scan(ColumnID{1}, ScanType::OpLessThanEquals, "c"),
+                  _create_expected({{3, "c"}, {1, "a"}, {2, "b"}}), true);
+  EXPECT_TABLE_EQ(scan(ColumnID{1}, ScanType::OpGreaterThan, "x"), _create_expected({}), true);
+
+  // The search value is converted into the type of the column
+  EXPECT_TABLE_EQ(scan(ColumnID{0}, ScanType::OpEquals, int64_t{4}), _create_expected({{4, "d"}}), true);
+}
+
+TEST_F(OperatorsTableScanTest, SortedChunks) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (const auto value : {1, 2, 2, 3, 4, 5, 5, 6}) table->append({value, std::to_string(value)});
+  table->compress_chunk(ChunkID{1});
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id).set_ordered_by(ColumnID{0});
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  table_scan->execute();
+  const auto& output = table_scan->get_output();
+  EXPECT_TABLE_EQ(output, _create_expected({{2, "2"}, {2, "2"}, {3, "3"}, {4, "4"}, {5, "5"}, {5, "5"}, {6, "6"}}),
+                  true);
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).ordered_by(), ColumnID{0});
+
+  table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 5);
+  table_scan->execute();
+  EXPECT_TABLE_EQ(table_scan->get_output(), _create_expected({{5, "5"}, {5, "5"}}), true);
+}
+
+TEST_F(OperatorsTableScanTest, ReferenceInput) {
+  auto first_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  first_scan->execute();
+  auto second_scan = std::make_shared<TableScan>(first_scan, ColumnID{1}, ScanType::OpLessThan, "f");
+  second_scan->execute();
+
+  const auto& output = second_scan->get_output();
+  EXPECT_TABLE_EQ(output, _create_expected({{5, "e"}, {3, "c"}, {4, "d"}, {2, "b"}}), true);
+
+  // The output references the data table, not the output of the first scan
+  const auto segment =
+      std::dynamic_pointer_cast<ReferenceSegment>(output->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), _table_wrapper->get_output());
+}
+
+}  // namespace opossum
@@ -0,0 +1,96 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/limit.hpp"
+#include "../lib/operators/sort.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/operators/top_k.hpp"
+#include "../lib/resolve_type.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_queue_scheduler.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void TearDown() override { CurrentScheduler::set(nullptr); }
+
+  // creates a table with an id column and a value column of the given type. The values of each chunk cover a range
+  // that overlaps with the neighboring chunks, and most chunks are dictionary-encoded, so that some chunks can be
+  // skipped.
+  static std::shared_ptr<TableWrapper> _create_table(const std::string& type) {
+    auto table = std::make_shared<Table>(100);
+    table->add_column("id", "int");
+    table->add_column("value", type);
+    for (auto row = int32_t{0}; row < 2'000; ++row) {
+      const auto number = (row / 100) * 50 + (row * 37) % 100 - 500;
+      auto value = AllTypeVariant{};
+      resolve_data_type(type, [&](auto data_type) {
+        using T = typename decltype(data_type)::type;
+        if constexpr (std::is_same_v<T, std::string>) {
+          value = std::to_string(number + 1'000);
+        } else {
+          value = static_cast<T>(number);
+        }
+      });
+      table->append({row, value});
+    }
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      if (chunk_id % 5 != 2) table->compress_chunk(chunk_id);
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // Checks the TopK operator against a Sort followed by a Limit
+  static void _check_top_k(const std::shared_ptr<AbstractOperator>& input, const SortColumnDefinition& definition,
+                           const size_t k) {
+    auto top_k = std::make_shared<TopK>(input, definition, k);
+    top_k->execute();
+
+    auto sort = std::make_shared<Sort>(input, std::vector<SortColumnDefinition>{definition});
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, k);
+    limit->execute();
+
+    EXPECT_TABLE_EQ(top_k->get_output(), limit->get_output(), true);
+  }
+};
+
+TEST_F(OperatorsTopKTest, AllTypes) {
+  for (const auto& type : {"int", "long", "float", "double", "string"}) {
+    const auto input = _create_table(type);
+    for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+      for (const auto k : {size_t{0}, size_t{1}, size_t{50}, size_t{250}, size_t{5'000}}) {
+        _check_top_k(input, SortColumnDefinition{ColumnID{1}, order_by_mode}, k);
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsTopKTest, ParallelHeaps) {
+  CurrentScheduler::set(std::make_shared<TaskQueueScheduler>(4));
+
+  const auto input = _create_table("int");
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+    _check_top_k(input, SortColumnDefinition{ColumnID{1}, order_by_mode}, 50);
+  }
+}
+
+TEST_F(OperatorsTopKTest, ReferenceInput) {
+  const auto input = _create_table("double");
+  auto limit = std::make_shared<Limit>(input, 1'234);
+  limit->execute();
+
+  _check_top_k(limit, SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}, 20);
+}
+
+}  // namespace opossum
@@ -0,0 +1,108 @@
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/get_table.hpp"
+#include "../lib/operators/print.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/job_task.hpp"
+#include "../lib/scheduler/operator_task.hpp"
+#include "../lib/scheduler/task_queue_scheduler.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+// Checks that the given tasks are executed in an order that respects their dependencies
+class SchedulerTest : public BaseTest {
+ protected:
+  void TearDown() override { CurrentScheduler::set(nullptr); }
+
+  void _test_dependencies() {
+    auto order = std::vector<int>{};
+    auto order_mutex = std::mutex{};
+    const auto make_task = [&](const int id) {
+      return std::make_shared<JobTask>([&, id]() {
+        std::lock_guard lock(order_mutex);
+        order.push_back(id);
+      });
+    };
+
+    // 0 -> 1 -> 3 and 0 -> 2 -> 3
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{make_task(0), make_task(1), make_task(2), make_task(3)};
+    tasks[0]->set_as_predecessor_of(tasks[1]);
+    tasks[0]->set_as_predecessor_of(tasks[2]);
+    tasks[1]->set_as_predecessor_of(tasks[3]);
+    tasks[2]->set_as_predecessor_of(tasks[3]);
+
+    // Scheduling the successors first must not change the order
+    CurrentScheduler::schedule_and_wait_for_tasks({tasks[3], tasks[2], tasks[1], tasks[0]});
+
+    ASSERT_EQ(order.size(), 4u);
+    EXPECT_EQ(order.front(), 0);
+    EXPECT_EQ(order.back(), 3);
+    for (const auto& task : tasks) {
+      EXPECT_TRUE(task->is_done());
+    }
+  }
+};
+
+TEST_F(SchedulerTest, DependenciesWithoutScheduler) { _test_dependencies(); }
+
+TEST_F(SchedulerTest, DependenciesWithScheduler) {
+  CurrentScheduler::set(std::make_shared<TaskQueueScheduler>(4));
+  EXPECT_TRUE(CurrentScheduler::is_set());
+  EXPECT_EQ(CurrentScheduler::get()->worker_count(), 4u);
+
+  for (auto iteration = 0; iteration < 20; ++iteration) {
+    _test_dependencies();
+  }
+}
+
+TEST_F(SchedulerTest, NestedJobs) {
+  // A single worker executes the outer job, so the inner jobs can only finish if the waiting thread helps out
+  CurrentScheduler::set(std::make_shared<TaskQueueScheduler>(1));
+
+  auto counter = std::atomic<int>{0};
+  auto outer_job = std::make_shared<JobTask>([&]() {
+    auto inner_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto job_index = 0; job_index < 10; ++job_index) {
+      inner_jobs.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(inner_jobs);
+  });
+  outer_job->schedule();
+  outer_job->join();
+
+  EXPECT_EQ(counter, 10);
+}
+
+TEST_F(SchedulerTest, OperatorTasks) {
+  CurrentScheduler::set(std::make_shared<TaskQueueScheduler>(2));
+  StorageManager::get().add_table("table", std::make_shared<Table>());
+
+  // The GetTable operator is shared by both Print operators and must only be executed once
+  auto get_table = std::make_shared<GetTable>("table");
+  auto print_a = std::make_shared<Print>(get_table, std::cout);
+  auto print_b = std::make_shared<Print>(print_a, std::cout);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(print_b);
+  ASSERT_EQ(tasks.size(), 3u);
+  EXPECT_EQ(std::static_pointer_cast<OperatorTask>(tasks[0])->get_operator(), get_table);
+  EXPECT_EQ(std::static_pointer_cast<OperatorTask>(tasks[2])->get_operator(), print_b);
+  EXPECT_EQ(tasks[0]->successors().size(), 1u);
+
+  testing::internal::CaptureStdout();
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  testing::internal::GetCapturedStdout();
+
+  EXPECT_EQ(print_b->get_output(), get_table->get_output());
+  EXPECT_GT(get_table->performance_data().walltime.count(), 0);
+  EXPECT_GT(print_b->performance_data().walltime.count(), 0);
+}
+
+}  // namespace opossum
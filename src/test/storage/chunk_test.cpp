@@ -58,6 +58,19 @@ TEST_F(StorageChunkTest, RetrieveSegment) {
   EXPECT_EQ(base_segment->size(), 4u);
 }
 
+TEST_F(StorageChunkTest, OrderedBy) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  EXPECT_FALSE(c.ordered_by());
+
+  c.set_ordered_by(ColumnID{1});
+  EXPECT_EQ(c.ordered_by(), ColumnID{1});
+
+  // Appending might break the order
+  c.append({2, "two"});
+  EXPECT_FALSE(c.ordered_by());
+}
+
 TEST_F(StorageChunkTest, UnknownSegmentType) {
   // Exception will only be thrown in debug builds
   if (IS_DEBUG) {
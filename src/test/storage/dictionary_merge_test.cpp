@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_merge.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageDictionaryMergeTest : public BaseTest {};
+
+TEST_F(StorageDictionaryMergeTest, MergeDelta) {
+  auto main_values = std::make_shared<ValueSegment<std::string>>();
+  for (const auto& value : {"Bill", "Steve", "Bill", "Hasso"}) main_values->append(value);
+  const auto main = make_shared_by_data_type<BaseSegment, DictionarySegment>(DataType::String, main_values);
+
+  auto delta = ValueSegment<std::string>{};
+  for (const auto& value : {"Alexander", "Steve", "Zoe", "Alexander"}) delta.append(value);
+
+  const auto merged_segment =
+      merge_delta_segment(*main, delta, DataType::String, std::pmr::get_default_resource());
+  const auto merged = std::dynamic_pointer_cast<DictionarySegment<std::string>>(merged_segment);
+  ASSERT_TRUE(merged);
+
+  EXPECT_EQ(*merged->dictionary(), (pmr_vector<std::string>{"Alexander", "Bill", "Hasso", "Steve", "Zoe"}));
+  const auto expected_values = std::vector<std::string>{"Bill",      "Steve", "Bill", "Hasso",
+                                                        "Alexander", "Steve", "Zoe",  "Alexander"};
+  ASSERT_EQ(merged->size(), expected_values.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < merged->size(); ++chunk_offset) {
+    EXPECT_EQ(merged->get(chunk_offset), expected_values[chunk_offset]);
+  }
+
+  // The inputs are not modified
+  EXPECT_EQ(main->size(), 4u);
+  EXPECT_EQ(delta.size(), 4u);
+}
+
+TEST_F(StorageDictionaryMergeTest, WidenAttributeVector) {
+  auto main_values = std::make_shared<ValueSegment<int32_t>>();
+  for (auto value = int32_t{0}; value < 200; ++value) main_values->append(value * 2);
+  const auto main = make_shared_by_data_type<BaseSegment, DictionarySegment>(DataType::Int, main_values);
+  EXPECT_EQ(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(main)->attribute_vector()->width(), 1u);
+
+  auto delta = ValueSegment<int32_t>{};
+  for (auto value = int32_t{0}; value < 200; ++value) delta.append(value * 2 + 1);
+
+  const auto merged = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+      merge_delta_segment(*main, delta, DataType::Int, std::pmr::get_default_resource()));
+  ASSERT_TRUE(merged);
+  EXPECT_EQ(merged->unique_values_count(), 400u);
+  EXPECT_EQ(merged->attribute_vector()->width(), 2u);
+  EXPECT_EQ(merged->get(ChunkOffset{10}), 20);
+  EXPECT_EQ(merged->get(ChunkOffset{210}), 21);
+}
+
+TEST_F(StorageDictionaryMergeTest, MergeDictionarySegments) {
+  auto first_values = std::make_shared<ValueSegment<std::string>>();
+  for (const auto& value : {"Bill", "Steve", "Bill"}) first_values->append(value);
+  auto second_values = std::make_shared<ValueSegment<std::string>>();
+  for (const auto& value : {"Hasso", "Alexander", "Steve"}) second_values->append(value);
+  const auto first = make_shared_by_data_type<BaseSegment, DictionarySegment>(DataType::String, first_values);
+  const auto second = make_shared_by_data_type<BaseSegment, DictionarySegment>(DataType::String, second_values);
+
+  const auto merged = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      merge_dictionary_segments(*first, *second, DataType::String, std::pmr::get_default_resource()));
+  ASSERT_TRUE(merged);
+
+  EXPECT_EQ(*merged->dictionary(), (pmr_vector<std::string>{"Alexander", "Bill", "Hasso", "Steve"}));
+  const auto expected_values = std::vector<std::string>{"Bill", "Steve", "Bill", "Hasso", "Alexander", "Steve"};
+  ASSERT_EQ(merged->size(), expected_values.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < merged->size(); ++chunk_offset) {
+    EXPECT_EQ(merged->get(chunk_offset), expected_values[chunk_offset]);
+  }
+}
+
+TEST_F(StorageDictionaryMergeTest, MergeManyDictionarySegments) {
+  // Ten small segments with overlapping values, which need a wider attribute vector once they are merged
+  auto segments = std::vector<std::shared_ptr<BaseSegment>>{};
+  auto expected_values = std::vector<int64_t>{};
+  for (auto segment_index = int64_t{0}; segment_index < 10; ++segment_index) {
+    auto values = std::make_shared<ValueSegment<int64_t>>();
+    for (auto row = int64_t{0}; row < 100; ++row) {
+      values->append(segment_index * 50 + row);
+      expected_values.push_back(segment_index * 50 + row);
+    }
+    segments.push_back(make_shared_by_data_type<BaseSegment, DictionarySegment>(DataType::Long, values));
+  }
+
+  auto segment_pointers = std::vector<const BaseSegment*>{};
+  for (const auto& segment : segments) segment_pointers.push_back(segment.get());
+  const auto merged = std::dynamic_pointer_cast<DictionarySegment<int64_t>>(
+      merge_dictionary_segments(segment_pointers, DataType::Long, std::pmr::get_default_resource()));
+  ASSERT_TRUE(merged);
+
+  EXPECT_EQ(merged->unique_values_count(), 550u);
+  EXPECT_EQ(merged->attribute_vector()->width(), 2u);
+  EXPECT_TRUE(std::is_sorted(merged->dictionary()->cbegin(), merged->dictionary()->cend()));
+  ASSERT_EQ(merged->size(), expected_values.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < merged->size(); ++chunk_offset) {
+    EXPECT_EQ(merged->get(chunk_offset), expected_values[chunk_offset]);
+  }
+}
+
+TEST_F(StorageDictionaryMergeTest, MismatchingSegments) {
+  auto values = std::make_shared<ValueSegment<int32_t>>();
+  values->append(1);
+  EXPECT_THROW(merge_delta_segment(*values, *values, DataType::Int, std::pmr::get_default_resource()),
+               std::exception);
+  EXPECT_THROW(merge_dictionary_segments(*values, *values, DataType::Int, std::pmr::get_default_resource()),
+               std::exception);
+}
+
+}  // namespace opossum
@@ -1,9 +1,13 @@
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "../../lib/resolve_type.hpp"
+#include "../../lib/scheduler/current_scheduler.hpp"
+#include "../../lib/scheduler/task_queue_scheduler.hpp"
 #include "../../lib/storage/base_segment.hpp"
 #include "../../lib/storage/dictionary_segment.hpp"
 #include "../../lib/storage/value_segment.hpp"
@@ -92,3 +96,30 @@ TEST_F(StorageDictionarySegmentTest, ImmutableAppendTest) {
   auto const last_element = (*dict_col)[opossum::ChunkOffset(dict_col->size() - 1)];
   EXPECT_TRUE(boost::get<std::string>(last_element) == "Bill");
 }
+
+TEST_F(StorageDictionarySegmentTest, ParallelCompression) {
+  opossum::CurrentScheduler::set(std::make_shared<opossum::TaskQueueScheduler>(4));
+
+  const auto row_count = opossum::DictionarySegment<int>::PARALLEL_ENCODING_ROW_COUNT + 3;
+  for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+    vc_int->append(static_cast<int>(row_index * 7'919 % 100'003) - 50'000);
+  }
+  const auto dict_col = std::make_shared<opossum::DictionarySegment<int>>(vc_int);
+  opossum::CurrentScheduler::set(nullptr);
+
+  const auto& values = vc_int->values();
+  auto expected_dictionary = std::vector<int>(values.cbegin(), values.cend());
+  std::sort(expected_dictionary.begin(), expected_dictionary.end());
+  expected_dictionary.erase(std::unique(expected_dictionary.begin(), expected_dictionary.end()),
+                            expected_dictionary.end());
+
+  const auto& dictionary = *dict_col->dictionary();
+  ASSERT_EQ(dictionary.size(), expected_dictionary.size());
+  EXPECT_TRUE(std::equal(dictionary.cbegin(), dictionary.cend(), expected_dictionary.cbegin()));
+  EXPECT_EQ(dict_col->attribute_vector()->width(), sizeof(uint32_t));
+
+  ASSERT_EQ(dict_col->size(), row_count);
+  for (auto chunk_offset = size_t{0}; chunk_offset < row_count; ++chunk_offset) {
+    ASSERT_EQ(dict_col->get(chunk_offset), values[chunk_offset]);
+  }
+}
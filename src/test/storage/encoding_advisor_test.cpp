@@ -0,0 +1,78 @@
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/encoding_advisor.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageEncodingAdvisorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(70'000);
+    _table->add_column("unique_ints", "int");
+    _table->add_column("few_ints", "long");
+    _table->add_column("unique_strings", "string");
+    _table->add_column("few_strings", "string");
+    for (auto row = int32_t{0}; row < 70'000; ++row) {
+      const auto customer = "Customer#" + std::to_string(10'000'000 + row);
+      _table->append({row, int64_t{row % 10}, customer, std::string{row % 2 ? "A" : "R"}});
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageEncodingAdvisorTest, EstimateDistinctCount) {
+  const auto& chunk = _table->get_chunk(ChunkID{0});
+
+  const auto unique_statistics = EncodingAdvisor::estimate_statistics(*chunk.get_segment(ColumnID{0}), DataType::Int);
+  EXPECT_EQ(unique_statistics.row_count, 70'000u);
+  EXPECT_EQ(unique_statistics.sample_size, EncodingAdvisor::SAMPLE_SIZE);
+  EXPECT_GT(unique_statistics.estimated_distinct_count, 35'000u);
+
+  const auto few_statistics = EncodingAdvisor::estimate_statistics(*chunk.get_segment(ColumnID{1}), DataType::Long);
+  EXPECT_EQ(few_statistics.estimated_distinct_count, 10u);
+
+  const auto string_statistics =
+      EncodingAdvisor::estimate_statistics(*chunk.get_segment(ColumnID{3}), DataType::String);
+  EXPECT_DOUBLE_EQ(string_statistics.average_string_length, 1.0);
+}
+
+TEST_F(StorageEncodingAdvisorTest, EstimateEncodings) {
+  const auto statistics = SegmentEncodingStatistics{1'000, 1'000, 1'000, 0.0};
+  const auto estimates = EncodingAdvisor::estimate_encodings(statistics, DataType::Int);
+  ASSERT_EQ(estimates.size(), 2u);
+  EXPECT_EQ(estimates[0].encoding, SegmentEncoding::Dictionary);
+  EXPECT_EQ(estimates[0].size, 1'000u * 2 + 1'000u * 4);
+  EXPECT_EQ(estimates[1].encoding, SegmentEncoding::Unencoded);
+  EXPECT_EQ(estimates[1].size, 1'000u * 4);
+
+  EXPECT_EQ(EncodingAdvisor::estimate_encodings(statistics, DataType::String).size(), 3u);
+}
+
+TEST_F(StorageEncodingAdvisorTest, AdviseAndCompress) {
+  auto log = std::stringstream{};
+  const auto advisor = EncodingAdvisor{&log};
+  EXPECT_EQ(advisor.advise(*_table, ChunkID{0}),
+            (EncodingSpec{SegmentEncoding::Unencoded, SegmentEncoding::Dictionary, SegmentEncoding::StringHeap,
+                          SegmentEncoding::Dictionary}));
+
+  advisor.compress_chunk(*_table, ChunkID{0});
+  const auto& chunk = _table->get_chunk(ChunkID{0});
+  EXPECT_EQ(segment_encoding<int32_t>(*chunk.get_segment(ColumnID{0})), SegmentEncoding::Unencoded);
+  EXPECT_EQ(segment_encoding<std::string>(*chunk.get_segment(ColumnID{2})), SegmentEncoding::StringHeap);
+  EXPECT_EQ(type_cast<std::string>((*chunk.get_segment(ColumnID{2}))[ChunkOffset{42}]), "Customer#10000042");
+  EXPECT_FALSE(chunk.is_mutable());
+
+  EXPECT_NE(log.str().find("column unique_strings: StringHeap"), std::string::npos);
+  EXPECT_NE(log.str().find("saved"), std::string::npos);
+}
+
+}  // namespace opossum
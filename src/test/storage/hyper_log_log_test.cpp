@@ -0,0 +1,95 @@
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/hyper_log_log.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageHyperLogLogTest : public BaseTest {
+ protected:
+  // Five standard errors of a sketch with 2^12 registers
+  static constexpr auto MAX_RELATIVE_ERROR = 0.08;
+
+  void _expect_estimate_near(const size_t estimate, const size_t expected) {
+    EXPECT_NEAR(static_cast<double>(estimate), static_cast<double>(expected), MAX_RELATIVE_ERROR * expected);
+  }
+};
+
+TEST_F(StorageHyperLogLogTest, Estimate) {
+  auto sketch = HyperLogLog{};
+  EXPECT_EQ(sketch.estimate(), 0u);
+  EXPECT_EQ(sketch.exact_count(), 0u);
+
+  for (auto value = int64_t{0}; value < 100; ++value) sketch.add(value);
+  EXPECT_FALSE(sketch.exact_count());
+  _expect_estimate_near(sketch.estimate(), 100);
+
+  // Duplicates do not change the sketch
+  for (auto repetition = 0; repetition < 3; ++repetition) {
+    for (auto value = int64_t{0}; value < 200'000; ++value) sketch.add(value);
+  }
+  _expect_estimate_near(sketch.estimate(), 200'000);
+
+  auto string_sketch = HyperLogLog{};
+  for (auto value = 0; value < 50'000; ++value) string_sketch.add("Customer#" + std::to_string(value));
+  _expect_estimate_near(string_sketch.estimate(), 50'000);
+}
+
+TEST_F(StorageHyperLogLogTest, Merge) {
+  auto first = HyperLogLog{};
+  auto second = HyperLogLog{};
+  for (auto value = 0; value < 60'000; ++value) first.add(value);
+  for (auto value = 30'000; value < 90'000; ++value) second.add(value);
+
+  first.merge(second);
+  _expect_estimate_near(first.estimate(), 90'000);
+}
+
+TEST_F(StorageHyperLogLogTest, ExactForDictionarySegments) {
+  auto value_segment = std::make_shared<ValueSegment<std::string>>();
+  for (const auto value : {"b", "a", "c", "a", "b"}) value_segment->append(value);
+  const auto dictionary_segment = DictionarySegment<std::string>{value_segment};
+
+  auto sketch = HyperLogLog::from_segment(dictionary_segment, DataType::String);
+  EXPECT_EQ(sketch.exact_count(), 3u);
+  EXPECT_EQ(sketch.estimate(), 3u);
+
+  // Merging with an empty sketch keeps the exact count, merging with another one loses it
+  sketch.merge(HyperLogLog{});
+  EXPECT_EQ(sketch.exact_count(), 3u);
+  sketch.merge(HyperLogLog::from_segment(*value_segment, DataType::String));
+  EXPECT_FALSE(sketch.exact_count());
+  EXPECT_EQ(sketch.estimate(), 3u);
+}
+
+TEST_F(StorageHyperLogLogTest, TableDistinctCount) {
+  Table table{10'000};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  for (auto row = 0; row < 35'000; ++row) table.append({row % 25'000, std::to_string(row % 7)});
+
+  // Two chunks are compressed and have a sketch, the others are sketched on the fly
+  table.compress_chunk(ChunkID{0});
+  table.compress_chunk(ChunkID{1});
+  ASSERT_TRUE(table.get_chunk(ChunkID{0}).distinct_sketch(ColumnID{0}));
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).distinct_sketch(ColumnID{0})->exact_count(), 10'000u);
+  EXPECT_FALSE(table.get_chunk(ChunkID{2}).distinct_sketch(ColumnID{0}));
+
+  _expect_estimate_near(table.approx_distinct_count(ColumnID{0}), 25'000);
+  EXPECT_EQ(table.approx_distinct_count(ColumnID{1}), 7u);
+
+  // Merged chunks get a new sketch
+  table.merge_delta();
+  ASSERT_TRUE(table.get_chunk(ChunkID{2}).distinct_sketch(ColumnID{1}));
+  EXPECT_EQ(table.get_chunk(ChunkID{2}).distinct_sketch(ColumnID{1})->exact_count(), 7u);
+  _expect_estimate_near(table.approx_distinct_count(ColumnID{0}), 25'000);
+}
+
+}  // namespace opossum
@@ -0,0 +1,72 @@
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/segment_iterate.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/type_cast.hpp"
+
+namespace opossum {
+
+class StorageReferenceSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto row = 0; row < 8; ++row) {
+      _table->append({row * 10, "value" + std::to_string(row)});
+    }
+    _table->compress_chunk(ChunkID{1});
+
+    _pos_list = std::make_shared<PosList>(
+        PosList{{ChunkID{2}, 1}, {ChunkID{0}, 0}, {ChunkID{0}, 2}, {ChunkID{1}, 1}, {ChunkID{1}, 0}});
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<PosList> _pos_list;
+};
+
+TEST_F(StorageReferenceSegmentTest, ReferencesValues) {
+  const auto segment = ReferenceSegment{_table, ColumnID{0}, _pos_list};
+
+  EXPECT_EQ(segment.size(), 5u);
+  EXPECT_EQ(type_cast<int32_t>(segment[0]), 70);
+  EXPECT_EQ(type_cast<int32_t>(segment[3]), 40);
+  EXPECT_EQ(segment.referenced_table(), _table);
+  EXPECT_EQ(segment.referenced_column_id(), ColumnID{0});
+  EXPECT_EQ(segment.pos_list(), _pos_list);
+  EXPECT_GE(segment.estimate_memory_usage(), 5 * sizeof(RowID));
+}
+
+TEST_F(StorageReferenceSegmentTest, IsImmutable) {
+  auto segment = ReferenceSegment{_table, ColumnID{0}, _pos_list};
+  EXPECT_THROW(segment.append(1), std::exception);
+}
+
+TEST_F(StorageReferenceSegmentTest, SegmentForEach) {
+  // Runs of positions in the same chunk are read from value and dictionary segments
+  auto values = std::vector<std::string>{};
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  segment_for_each<std::string>(ReferenceSegment{_table, ColumnID{1}, _pos_list},
+                                [&](const ChunkOffset chunk_offset, const std::string_view value) {
+                                  chunk_offsets.push_back(chunk_offset);
+                                  values.emplace_back(value);
+                                });
+  EXPECT_EQ(values, (std::vector<std::string>{"value7", "value0", "value2", "value4", "value3"}));
+  EXPECT_EQ(chunk_offsets, (std::vector<ChunkOffset>{0, 1, 2, 3, 4}));
+
+  auto sum = 0;
+  segment_for_each<int32_t>(*_table->get_chunk(ChunkID{1}).get_segment(ColumnID{0}),
+                            [&](const ChunkOffset, const int32_t value) { sum += value; });
+  EXPECT_EQ(sum, 30 + 40 + 50);
+}
+
+}  // namespace opossum
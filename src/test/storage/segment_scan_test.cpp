@@ -0,0 +1,121 @@
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/segment_scan.hpp"
+#include "../lib/storage/string_heap_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageSegmentScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto value : {7, 3, 9, 3, 1, 7, 7}) int_value_segment->append(value);
+    int_dictionary_segment = std::make_shared<DictionarySegment<int32_t>>(int_value_segment);
+
+    for (const auto& value : {"Bill", "Steve", "Alexander", "Steve", "Hasso", "Bill"}) {
+      string_value_segment->append(value);
+      string_heap_segment->append(value);
+    }
+    string_dictionary_segment = std::make_shared<DictionarySegment<std::string>>(string_value_segment);
+  }
+
+  // Scans the segment and compares the result with a row-by-row evaluation of the predicate on the values
+  template <typename T>
+  void expect_scan_matches_values(const BaseSegment& segment, const std::vector<T>& search_values) {
+    const auto scan_types = {ScanType::OpEquals,      ScanType::OpNotEquals,   ScanType::OpLessThan,
+                             ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+    for (const auto scan_type : scan_types) {
+      for (const auto& search_value : search_values) {
+        auto expected_matches = PosList{};
+        resolve_scan_type(scan_type, [&](const auto& comparator) {
+          for (ChunkOffset chunk_offset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+            if (comparator(type_cast<T>(segment[chunk_offset]), search_value)) {
+              expected_matches.push_back(RowID{ChunkID{4}, chunk_offset});
+            }
+          }
+        });
+
+        auto matches = PosList{};
+        scan_segment(segment, data_type_of<T>, scan_type, search_value, ChunkID{4}, matches);
+        EXPECT_EQ(matches, expected_matches) << "ScanType " << static_cast<int>(scan_type) << ", " << search_value;
+      }
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> int_value_segment = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<DictionarySegment<int32_t>> int_dictionary_segment;
+  std::shared_ptr<ValueSegment<std::string>> string_value_segment = std::make_shared<ValueSegment<std::string>>();
+  std::shared_ptr<StringHeapSegment> string_heap_segment = std::make_shared<StringHeapSegment>();
+  std::shared_ptr<DictionarySegment<std::string>> string_dictionary_segment;
+};
+
+TEST_F(StorageSegmentScanTest, ScanIntSegments) {
+  // includes values before, between, on, and after the dictionary entries
+  const auto search_values = std::vector<int32_t>{0, 1, 2, 3, 7, 8, 9, 10};
+  expect_scan_matches_values(*int_value_segment, search_values);
+  expect_scan_matches_values(*int_dictionary_segment, search_values);
+}
+
+TEST_F(StorageSegmentScanTest, ScanStringSegments) {
+  const auto search_values = std::vector<std::string>{"", "Alexander", "Alexandra", "Bill", "Steve", "Zed"};
+  expect_scan_matches_values(*string_value_segment, search_values);
+  expect_scan_matches_values(*string_heap_segment, search_values);
+  expect_scan_matches_values(*string_dictionary_segment, search_values);
+}
+
+TEST_F(StorageSegmentScanTest, ScanSortedSegments) {
+  auto sorted_value_segment = std::make_shared<ValueSegment<std::string>>();
+  auto sorted_string_heap_segment = std::make_shared<StringHeapSegment>();
+  for (const auto& value : {"Alexander", "Bill", "Bill", "Hasso", "Steve", "Steve", "Steve"}) {
+    sorted_value_segment->append(value);
+    sorted_string_heap_segment->append(value);
+  }
+  const auto sorted_dictionary_segment = std::make_shared<DictionarySegment<std::string>>(sorted_value_segment);
+
+  // The range has to contain exactly the rows that a full scan finds
+  const auto scan_types = {ScanType::OpEquals, ScanType::OpLessThan, ScanType::OpLessThanEquals,
+                           ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto* segment : std::vector<const BaseSegment*>{sorted_value_segment.get(),
+                                                             sorted_string_heap_segment.get(),
+                                                             sorted_dictionary_segment.get()}) {
+    for (const auto scan_type : scan_types) {
+      for (const auto& search_value : {"", "Alexander", "Bill", "Charles", "Steve", "Zed"}) {
+        auto expected_matches = PosList{};
+        scan_segment(*segment, DataType::String, scan_type, search_value, ChunkID{0}, expected_matches);
+
+        const auto range = scan_sorted_segment(*segment, DataType::String, scan_type, search_value);
+        auto matches = PosList{};
+        for (auto chunk_offset = range.begin; chunk_offset < range.end; ++chunk_offset) {
+          matches.push_back(RowID{ChunkID{0}, chunk_offset});
+        }
+        EXPECT_EQ(matches, expected_matches) << "ScanType " << static_cast<int>(scan_type) << ", " << search_value;
+      }
+    }
+  }
+
+  EXPECT_THROW(scan_sorted_segment(*sorted_value_segment, DataType::String, ScanType::OpNotEquals, "Bill"),
+               std::logic_error);
+}
+
+TEST_F(StorageSegmentScanTest, ScanConvertsSearchValue) {
+  auto matches = PosList{};
+  scan_segment(*int_dictionary_segment, DataType::Int, ScanType::OpEquals, "7", ChunkID{0}, matches);
+  EXPECT_EQ(matches, (PosList{{ChunkID{0}, 0}, {ChunkID{0}, 5}, {ChunkID{0}, 6}}));
+}
+
+TEST_F(StorageSegmentScanTest, ResolveSegmentEncoding) {
+  EXPECT_EQ(segment_encoding<int32_t>(*int_value_segment), SegmentEncoding::Unencoded);
+  EXPECT_EQ(segment_encoding<int32_t>(*int_dictionary_segment), SegmentEncoding::Dictionary);
+  EXPECT_EQ(segment_encoding<std::string>(*string_heap_segment), SegmentEncoding::StringHeap);
+  EXPECT_THROW(segment_encoding<int64_t>(*int_value_segment), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,78 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/string_heap_segment.hpp"
+
+namespace opossum {
+
+class StorageStringHeapSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto segment : {header_segment, offset_segment}) {
+      segment->append("Hasso");
+      segment->append("");
+      segment->append("Alexander");
+      segment->append(AllTypeVariant{"Hasso Plattner"});
+      segment->append(42);
+    }
+  }
+
+  std::shared_ptr<StringHeapSegment> header_segment = std::make_shared<StringHeapSegment>(true);
+  std::shared_ptr<StringHeapSegment> offset_segment = std::make_shared<StringHeapSegment>(false);
+};
+
+TEST_F(StorageStringHeapSegmentTest, GetValues) {
+  for (auto segment : {header_segment, offset_segment}) {
+    EXPECT_EQ(segment->size(), 5u);
+    EXPECT_EQ(segment->get(ChunkOffset{0}), "Hasso");
+    EXPECT_EQ(segment->get(ChunkOffset{1}), "");
+    EXPECT_EQ(segment->get(ChunkOffset{2}), "Alexander");
+    EXPECT_EQ(segment->get(ChunkOffset{3}), "Hasso Plattner");
+    EXPECT_EQ(segment->get(ChunkOffset{4}), "42");
+    EXPECT_EQ(type_cast<std::string>((*segment)[ChunkOffset{3}]), "Hasso Plattner");
+  }
+}
+
+TEST_F(StorageStringHeapSegmentTest, ForEach) {
+  auto values = std::vector<std::string>{};
+  header_segment->for_each([&](const auto chunk_offset, const auto value) {
+    EXPECT_EQ(chunk_offset, values.size());
+    values.emplace_back(value);
+  });
+  EXPECT_EQ(values, (std::vector<std::string>{"Hasso", "", "Alexander", "Hasso Plattner", "42"}));
+}
+
+TEST_F(StorageStringHeapSegmentTest, Compare) {
+  for (auto segment : {header_segment, offset_segment}) {
+    EXPECT_EQ(segment->compare(ChunkOffset{0}, "Hasso"), 0);
+    EXPECT_LT(segment->compare(ChunkOffset{0}, "Hasso Plattner"), 0);
+    EXPECT_GT(segment->compare(ChunkOffset{3}, "Hasso"), 0);
+    EXPECT_LT(segment->compare(ChunkOffset{2}, "Alexandra"), 0);
+    EXPECT_LT(segment->compare(ChunkOffset{1}, "A"), 0);
+    EXPECT_GT(segment->compare(ChunkOffset{2}, "Ab"), 0);
+  }
+}
+
+TEST_F(StorageStringHeapSegmentTest, MemoryUsage) {
+  // Only "Alexander" and "Hasso Plattner" are too long to be inlined
+  EXPECT_EQ(header_segment->estimate_memory_usage(), 5 * sizeof(StringHeapSegment::StringHeader) + 9 + 14);
+  EXPECT_EQ(offset_segment->estimate_memory_usage(), 6 * sizeof(uint32_t) + 5 + 9 + 14 + 2);
+}
+
+TEST_F(StorageStringHeapSegmentTest, CompressToDictionarySegment) {
+  for (auto segment : {header_segment, offset_segment}) {
+    const auto dictionary_segment = DictionarySegment<std::string>{segment};
+    EXPECT_EQ(dictionary_segment.unique_values_count(), 5u);
+    EXPECT_EQ(dictionary_segment.value_by_value_id(ValueID{0}), "");
+    EXPECT_EQ(dictionary_segment.value_by_value_id(ValueID{4}), "Hasso Plattner");
+    EXPECT_EQ(dictionary_segment.get(2), "Alexander");
+    EXPECT_EQ(dictionary_segment.attribute_vector()->get(0), ValueID{3});
+  }
+}
+
+}  // namespace opossum
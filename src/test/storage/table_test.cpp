@@ -1,6 +1,8 @@
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -10,6 +12,8 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/dictionary_segment.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/utils/counting_memory_resource.hpp"
 
 namespace opossum {
 
@@ -65,6 +69,14 @@ TEST_F(StorageTableTest, GetColumnType) {
   // EXPECT_THROW(t.column_type(ColumnID{2}), std::exception);
 }
 
+TEST_F(StorageTableTest, GetColumnDataType) {
+  EXPECT_EQ(t.column_data_type(ColumnID{0}), DataType::Int);
+  EXPECT_EQ(t.column_data_type(ColumnID{1}), DataType::String);
+  EXPECT_EQ(data_type_to_string(DataType::Long), "long");
+  EXPECT_EQ(data_type_from_string("double"), DataType::Double);
+  EXPECT_THROW(t.add_column("col_3", "weird_type"), std::logic_error);
+}
+
 TEST_F(StorageTableTest, GetColumnIdByName) {
   EXPECT_EQ(t.column_id_by_name("col_2"), 1u);
   EXPECT_THROW(t.column_id_by_name("no_column_name"), std::exception);
@@ -119,4 +131,359 @@ TEST_F(StorageTableTest, CompressChunk) {
   EXPECT_EQ((*(segment_1_1->dictionary()))[1], "world");
 }
 
+TEST_F(StorageTableTest, AppendAfterCompression) {
+  t.append({4, "Hello,"});
+  t.compress_chunk(ChunkID{0});
+
+  // The compressed chunk is not full, but immutable, so the row opens a new delta
+  t.append({6, "world"});
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).size(), 1u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int>>(t.get_chunk(ChunkID{1}).get_segment(ColumnID{0})));
+}
+
+TEST_F(StorageTableTest, MergeDelta) {
+  Table table{4};
+  table.add_column("col_1", "int");
+  table.add_column("col_2", "string");
+
+  // Without a main, the delta is compressed on its own
+  table.append({4, "b"});
+  table.append({2, "a"});
+  table.merge_delta();
+  EXPECT_EQ(table.chunk_count(), 2u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int>>(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0})));
+  EXPECT_EQ(table.get_chunk(ChunkID{1}).size(), 0u);
+
+  // The merged delta leaves an empty chunk behind, so that the ChunkIDs of later chunks do not change
+  table.append({3, "c"});
+  table.append({4, "a"});
+  table.merge_delta();
+  EXPECT_EQ(table.chunk_count(), 3u);
+  EXPECT_EQ(table.row_count(), 4u);
+  EXPECT_EQ(table.get_chunk(ChunkID{1}).size(), 0u);
+  EXPECT_FALSE(table.get_chunk(ChunkID{1}).is_mutable());
+
+  const auto& main = table.get_chunk(ChunkID{0});
+  const auto segment_0 = std::dynamic_pointer_cast<DictionarySegment<int>>(main.get_segment(ColumnID{0}));
+  const auto segment_1 = std::dynamic_pointer_cast<DictionarySegment<std::string>>(main.get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment_0 && segment_1);
+  EXPECT_EQ(*segment_0->dictionary(), (pmr_vector<int>{2, 3, 4}));
+  EXPECT_EQ(*segment_1->dictionary(), (pmr_vector<std::string>{"a", "b", "c"}));
+  EXPECT_EQ(segment_0->get(3), 4);
+  EXPECT_EQ(segment_1->get(2), "c");
+
+  // The main is full, so the next delta becomes a main of its own
+  table.append({1, "d"});
+  table.merge_delta();
+  EXPECT_EQ(table.chunk_count(), 4u);
+  EXPECT_EQ(table.get_chunk(ChunkID{2}).size(), 1u);
+
+  // Empty chunks between the main and the delta are skipped
+  const auto old_main = table.get_chunk_snapshot(ChunkID{2});
+  table.append({5, "e"});
+  table.merge_delta();
+  EXPECT_EQ(table.chunk_count(), 5u);
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).size(), 4u);
+  EXPECT_EQ(table.get_chunk(ChunkID{2}).size(), 2u);
+  EXPECT_EQ(table.get_chunk(ChunkID{3}).size(), 0u);
+
+  // A snapshot of a replaced chunk can still be read
+  EXPECT_EQ(old_main->size(), 1u);
+  EXPECT_EQ(type_cast<std::string>((*old_main->get_segment(ColumnID{1}))[ChunkOffset{0}]), "d");
+
+  // Without a delta, nothing happens
+  table.merge_delta();
+  EXPECT_EQ(table.chunk_count(), 5u);
+}
+
+TEST_F(StorageTableTest, MergeDeltaWhileAppending) {
+  Table table{1'000};
+  table.add_column("col_1", "int");
+  for (auto row = int32_t{0}; row < 500; ++row) table.append({row});
+  table.compress_chunk(ChunkID{0});
+
+  auto merge_count = 0;
+  auto appender = std::thread([&]() {
+    for (auto row = int32_t{500}; row < 2'000; ++row) table.append({row});
+  });
+  while (merge_count < 10) {
+    table.merge_delta();
+    ++merge_count;
+  }
+  appender.join();
+  for (auto remaining_merge = 0; remaining_merge < 5; ++remaining_merge) table.merge_delta();
+
+  // No row was lost or reordered, and all of them are compressed
+  auto expected_row = int32_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto segment = table.get_chunk(chunk_id).get_segment(ColumnID{0});
+    if (segment->size() == 0) continue;
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int>>(segment));
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+      EXPECT_EQ(type_cast<int32_t>((*segment)[chunk_offset]), expected_row++);
+    }
+  }
+  EXPECT_EQ(expected_row, 2'000);
+}
+
+TEST_F(StorageTableTest, Snapshot) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  const auto snapshot = t.snapshot();
+
+  // Neither appends nor merges of the delta change the snapshot
+  t.append({5, "?"});
+  t.compress_chunk(ChunkID{0});
+  t.merge_delta();
+  EXPECT_EQ(snapshot->row_count(), 3u);
+  EXPECT_EQ(snapshot->column_names(), t.column_names());
+  EXPECT_EQ(snapshot->max_chunk_size(), t.max_chunk_size());
+  EXPECT_TRUE(std::dynamic_pointer_cast<const ValueSegment<int>>(
+      snapshot->get_chunk_snapshot(ChunkID{0})->get_segment(ColumnID{0})));
+  EXPECT_EQ(type_cast<int32_t>((*snapshot->get_chunk_snapshot(ChunkID{1})->get_segment(ColumnID{0}))[0]), 3);
+}
+
+TEST_F(StorageTableTest, MergeDeltaWhileReading) {
+  Table table{100};
+  table.add_column("col_1", "int");
+  for (auto row = int32_t{0}; row < 50; ++row) table.append({row});
+  table.compress_chunk(ChunkID{0});
+
+  // Returns the rows of a snapshot in the order of their RowIDs
+  const auto read_rows = [](const Table& snapshot) {
+    auto rows = std::vector<int32_t>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < snapshot.chunk_count(); ++chunk_id) {
+      const auto segment = snapshot.get_chunk_snapshot(chunk_id)->get_segment(ColumnID{0});
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+        rows.push_back(type_cast<int32_t>((*segment)[chunk_offset]));
+      }
+    }
+    return rows;
+  };
+
+  auto done = std::atomic<bool>{false};
+  auto appender = std::thread([&]() {
+    for (auto row = int32_t{50}; row < 2'000; ++row) table.append({row});
+    done = true;
+  });
+
+  // Every snapshot holds every row of main and delta exactly once, no matter when it is taken during a merge
+  auto reader_failures = std::atomic<size_t>{0};
+  auto first_snapshot = std::shared_ptr<const Table>{};
+  auto first_rows = std::vector<int32_t>{};
+  auto reader = std::thread([&]() {
+    first_snapshot = table.snapshot();
+    first_rows = read_rows(*first_snapshot);
+    auto previous_row_count = size_t{0};
+    while (!done) {
+      const auto rows = read_rows(*table.snapshot());
+      auto expected_row = int32_t{0};
+      for (const auto row : rows) {
+        if (row != expected_row++) ++reader_failures;
+      }
+      if (rows.size() < previous_row_count) ++reader_failures;
+      previous_row_count = rows.size();
+    }
+  });
+
+  while (!done) table.merge_delta();
+  appender.join();
+  reader.join();
+  for (auto remaining_merge = 0; remaining_merge < 25; ++remaining_merge) table.merge_delta();
+
+  EXPECT_EQ(reader_failures, 0u);
+  // The snapshot still reads the same rows, although all of its chunks were merged in the meantime
+  EXPECT_EQ(read_rows(*first_snapshot), first_rows);
+  EXPECT_EQ(read_rows(*table.snapshot()).size(), 2'000u);
+}
+
+TEST_F(StorageTableTest, CompressChunkWithEncodingSpec) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  EXPECT_THROW(t.compress_chunk(ChunkID{0}, EncodingSpec{SegmentEncoding::Unencoded}), std::exception);
+  EXPECT_THROW(t.compress_chunk(ChunkID{0}, EncodingSpec{SegmentEncoding::StringHeap, SegmentEncoding::StringHeap}),
+               std::exception);
+
+  t.compress_chunk(ChunkID{0}, EncodingSpec{SegmentEncoding::Unencoded, SegmentEncoding::StringHeap});
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  EXPECT_FALSE(chunk.is_mutable());
+  EXPECT_EQ(segment_encoding<int32_t>(*chunk.get_segment(ColumnID{0})), SegmentEncoding::Unencoded);
+  EXPECT_EQ(segment_encoding<std::string>(*chunk.get_segment(ColumnID{1})), SegmentEncoding::StringHeap);
+  EXPECT_EQ(type_cast<std::string>((*chunk.get_segment(ColumnID{1}))[ChunkOffset{1}]), "world");
+}
+
+TEST_F(StorageTableTest, MergeDeltaKeepsEncoding) {
+  Table table{4};
+  table.add_column("col_1", "int");
+  table.add_column("col_2", "string");
+  table.append({4, "b"});
+  table.compress_chunk(ChunkID{0}, EncodingSpec{SegmentEncoding::Unencoded, SegmentEncoding::StringHeap});
+
+  // The compressed chunk is immutable even though its first segment is a ValueSegment
+  table.append({2, "a"});
+  EXPECT_EQ(table.chunk_count(), 2u);
+
+  table.merge_delta();
+  EXPECT_EQ(table.chunk_count(), 3u);
+  const auto& main = table.get_chunk(ChunkID{0});
+  EXPECT_EQ(main.size(), 2u);
+  EXPECT_EQ(segment_encoding<int32_t>(*main.get_segment(ColumnID{0})), SegmentEncoding::Unencoded);
+  EXPECT_EQ(segment_encoding<std::string>(*main.get_segment(ColumnID{1})), SegmentEncoding::StringHeap);
+  EXPECT_EQ(type_cast<int32_t>((*main.get_segment(ColumnID{0}))[ChunkOffset{1}]), 2);
+  EXPECT_EQ(type_cast<std::string>((*main.get_segment(ColumnID{1}))[ChunkOffset{1}]), "a");
+}
+
+TEST_F(StorageTableTest, Reorganize) {
+  Table table{3};
+  table.add_column("col_1", "int");
+  table.add_column("col_2", "string");
+  for (const auto value : {5, 3, 8, 1, 9, 2, 7}) table.append({value, std::to_string(value)});
+  table.compress_chunk(ChunkID{0});
+
+  table.reorganize(ColumnID{0});
+
+  // 7 rows in chunks of 3, plus a new chunk for appends, as the last chunk was included
+  ASSERT_EQ(table.chunk_count(), 4u);
+  auto chunk_id = ChunkID{0};
+  for (const auto& expected_values : {std::vector<int32_t>{1, 2, 3}, {5, 7, 8}, {9}}) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    ++chunk_id;
+    EXPECT_EQ(chunk.ordered_by(), ColumnID{0});
+    EXPECT_FALSE(chunk.is_mutable());
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk.get_segment(ColumnID{0})));
+    ASSERT_EQ(chunk.size(), expected_values.size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      EXPECT_EQ(type_cast<int32_t>((*chunk.get_segment(ColumnID{0}))[chunk_offset]), expected_values[chunk_offset]);
+      EXPECT_EQ(type_cast<std::string>((*chunk.get_segment(ColumnID{1}))[chunk_offset]),
+                std::to_string(expected_values[chunk_offset]));
+    }
+  }
+
+  table.append({4, "4"});
+  EXPECT_EQ(table.get_chunk(ChunkID{3}).size(), 1u);
+}
+
+TEST_F(StorageTableTest, ReorganizeRange) {
+  Table table{2};
+  table.add_column("col_1", "int");
+  for (const auto value : {6, 5, 4, 3, 2, 1}) table.append({value});
+
+  // Only the last two of the three chunks are sorted
+  table.reorganize(ColumnID{0}, ChunkID{1}, ChunkID{3});
+  ASSERT_EQ(table.chunk_count(), 4u);
+  EXPECT_FALSE(table.get_chunk(ChunkID{0}).ordered_by());
+  EXPECT_EQ(type_cast<int32_t>((*table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}))[ChunkOffset{0}]), 6);
+  EXPECT_EQ(type_cast<int32_t>((*table.get_chunk(ChunkID{1}).get_segment(ColumnID{0}))[ChunkOffset{0}]), 1);
+  EXPECT_EQ(type_cast<int32_t>((*table.get_chunk(ChunkID{2}).get_segment(ColumnID{0}))[ChunkOffset{1}]), 4);
+  EXPECT_EQ(table.get_chunk(ChunkID{3}).size(), 0u);
+
+  EXPECT_THROW(table.reorganize(ColumnID{0}, ChunkID{2}, ChunkID{5}), std::exception);
+  EXPECT_THROW(table.reorganize(ColumnID{1}), std::exception);
+}
+
+TEST_F(StorageTableTest, ShareDictionaries) {
+  Table table{3};
+  table.add_column("col_1", "int");
+  table.add_column("col_2", "string");
+  for (const auto value : {5, 3, 8, 1, 5, 2, 8, 4}) table.append({value, std::to_string(value)});
+  table.compress_chunk(ChunkID{0});
+  table.compress_chunk(ChunkID{1});
+  const auto old_chunk = table.get_chunk_snapshot(ChunkID{0});
+
+  table.share_dictionaries(ColumnID{0});
+
+  // The chunks are replaced by copies that keep the metadata, while a snapshot of an old chunk keeps its segment
+  const auto& new_chunk = table.get_chunk(ChunkID{0});
+  EXPECT_NE(new_chunk.get_segment(ColumnID{0}), old_chunk->get_segment(ColumnID{0}));
+  EXPECT_EQ(new_chunk.get_segment(ColumnID{1}), old_chunk->get_segment(ColumnID{1}));
+  EXPECT_FALSE(new_chunk.is_mutable());
+  EXPECT_EQ(new_chunk.distinct_sketch(ColumnID{0}), old_chunk->distinct_sketch(ColumnID{0}));
+  EXPECT_EQ(type_cast<int32_t>((*old_chunk->get_segment(ColumnID{0}))[ChunkOffset{2}]), 8);
+
+  const auto dictionary_segment = [&](const ChunkID chunk_id) {
+    return std::dynamic_pointer_cast<DictionarySegment<int32_t>>(table.get_chunk(chunk_id).get_segment(ColumnID{0}));
+  };
+  const auto first_segment = dictionary_segment(ChunkID{0});
+  const auto second_segment = dictionary_segment(ChunkID{1});
+  ASSERT_TRUE(first_segment && second_segment);
+  EXPECT_EQ(first_segment->dictionary(), second_segment->dictionary());
+  EXPECT_EQ(*first_segment->dictionary(), (pmr_vector<int32_t>{1, 2, 3, 5, 8}));
+
+  // The same value has the same ValueID in both chunks, and the rows did not change
+  EXPECT_EQ(first_segment->attribute_vector()->get(0), second_segment->attribute_vector()->get(1));
+  auto row = size_t{0};
+  for (const auto value : {5, 3, 8, 1, 5, 2}) {
+    EXPECT_EQ(dictionary_segment(ChunkID{static_cast<uint32_t>(row / 3)})->get(row % 3), value);
+    ++row;
+  }
+
+  // Other columns and the uncompressed last chunk are left alone
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(table.get_chunk(ChunkID{0}).get_segment(
+                ColumnID{1}))->dictionary(),
+            std::dynamic_pointer_cast<DictionarySegment<std::string>>(table.get_chunk(ChunkID{1}).get_segment(
+                ColumnID{1}))->dictionary());
+  EXPECT_FALSE(dictionary_segment(ChunkID{2}));
+  table.append({9, "9"});
+  EXPECT_EQ(table.get_chunk(ChunkID{2}).size(), 3u);
+}
+
+TEST_F(StorageTableTest, ChunkArenas) {
+  CountingMemoryResource arena_resource;
+  CountingMemoryResource heap_resource;
+  {
+    Table arena_table{100, &arena_resource, true};
+    Table heap_table{100, &heap_resource, false};
+    for (auto table : {&arena_table, &heap_table}) {
+      table->add_column("col_1", "int");
+      table->add_column("col_2", "long");
+      for (int32_t row = 0; row < 200; ++row) table->append({row, int64_t{row % 3}});
+    }
+
+    // Growing segments take a few large arena blocks instead of one allocation per reallocation
+    EXPECT_LT(arena_resource.allocation_count(), heap_resource.allocation_count());
+
+    // Nothing is freed while the chunks are built, compression releases the whole arena of the value segments
+    EXPECT_EQ(arena_resource.deallocation_count(), 0u);
+    const auto live_bytes_before_compression = arena_resource.live_bytes();
+    arena_table.compress_chunk(ChunkID{1});
+    EXPECT_GT(arena_resource.deallocation_count(), 0u);
+    EXPECT_LT(arena_resource.live_bytes(), live_bytes_before_compression);
+
+    // A segment that is still in use keeps the arena of its replaced chunk alive
+    auto value_segment = arena_table.get_chunk(ChunkID{0}).get_segment(ColumnID{1});
+    const auto live_bytes_before_second_compression = arena_resource.live_bytes();
+    arena_table.compress_chunk(ChunkID{0});
+    EXPECT_GE(arena_resource.live_bytes(), live_bytes_before_second_compression);
+    EXPECT_EQ(type_cast<int64_t>((*value_segment)[ChunkOffset{5}]), 2);
+    value_segment.reset();
+    EXPECT_LT(arena_resource.live_bytes(), live_bytes_before_second_compression);
+
+    const auto segment = arena_table.get_chunk(ChunkID{1}).get_segment(ColumnID{0});
+    EXPECT_EQ(type_cast<int32_t>((*segment)[ChunkOffset{3}]), 103);
+  }
+  EXPECT_EQ(arena_resource.live_bytes(), 0u);
+  EXPECT_EQ(heap_resource.live_bytes(), 0u);
+}
+
+TEST_F(StorageTableTest, ChunkArenasOnHugePages) {
+  CountingMemoryResource upstream;
+  auto segment = std::shared_ptr<BaseSegment>{};
+  {
+    Table table{1'000, &upstream, true, true};
+    table.add_column("col_1", "int");
+    for (int32_t row = 0; row < 2'000; ++row) table.append({row});
+    table.compress_chunk(ChunkID{0});
+    segment = table.get_chunk(ChunkID{1}).get_segment(ColumnID{0});
+
+    // Every arena block is a huge page, so nothing is taken from the upstream resource
+    EXPECT_EQ(upstream.allocation_count(), 0u);
+    EXPECT_EQ(type_cast<int32_t>((*table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}))[ChunkOffset{7}]), 7);
+  }
+
+  // The segment keeps its arena and the huge page resource alive
+  EXPECT_EQ(type_cast<int32_t>((*segment)[ChunkOffset{7}]), 1'007);
+}
+
 }  // namespace opossum
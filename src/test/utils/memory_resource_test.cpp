@@ -0,0 +1,46 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/utils/counting_memory_resource.hpp"
+#include "../lib/utils/huge_page_memory_resource.hpp"
+
+namespace opossum {
+
+class MemoryResourceTest : public BaseTest {};
+
+TEST_F(MemoryResourceTest, CountingMemoryResourceCounts) {
+  CountingMemoryResource counting_resource;
+  {
+    pmr_vector<int32_t> values(&counting_resource);
+    values.resize(100);
+    EXPECT_EQ(counting_resource.allocation_count(), 1u);
+    EXPECT_EQ(counting_resource.live_bytes(), 100 * sizeof(int32_t));
+  }
+  EXPECT_EQ(counting_resource.deallocation_count(), 1u);
+  EXPECT_EQ(counting_resource.live_bytes(), 0u);
+
+  counting_resource.reset();
+  EXPECT_EQ(counting_resource.allocation_count(), 0u);
+  EXPECT_EQ(counting_resource.allocated_bytes(), 0u);
+}
+
+TEST_F(MemoryResourceTest, HugePageMemoryResourceForwardsSmallAllocations) {
+  CountingMemoryResource upstream;
+  HugePageMemoryResource huge_page_resource{HugePageMemoryResource::HUGE_PAGE_SIZE, &upstream};
+
+  pmr_vector<int32_t> small_values(16, &huge_page_resource);
+  EXPECT_EQ(upstream.allocation_count(), 1u);
+
+  pmr_vector<int32_t> large_values(HugePageMemoryResource::HUGE_PAGE_SIZE, &huge_page_resource);
+  EXPECT_EQ(upstream.allocation_count(), 1u);
+
+  // large allocations are aligned to huge page boundaries
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(large_values.data()) % HugePageMemoryResource::HUGE_PAGE_SIZE, 0u);
+  large_values.back() = 17;
+  EXPECT_EQ(large_values.back(), 17);
+}
+
+}  // namespace opossum
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/utils/tpch_table_generator.hpp"
+
+namespace opossum {
+
+class TpchTableGeneratorTest : public BaseTest {
+ protected:
+  template <typename T>
+  std::vector<T> _column_values(const Table& table, const ColumnID column_id) {
+    auto values = std::vector<T>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto segment = std::dynamic_pointer_cast<ValueSegment<T>>(table.get_chunk(chunk_id).get_segment(column_id));
+      EXPECT_NE(segment, nullptr);
+      values.insert(values.end(), segment->values().begin(), segment->values().end());
+    }
+    return values;
+  }
+};
+
+TEST_F(TpchTableGeneratorTest, RowCounts) {
+  const auto tables = TpchTableGenerator{0.01f, 1'000}.generate();
+
+  EXPECT_EQ(tables.size(), 8u);
+  EXPECT_EQ(tables.at("region")->row_count(), 5u);
+  EXPECT_EQ(tables.at("nation")->row_count(), 25u);
+  EXPECT_EQ(tables.at("supplier")->row_count(), 100u);
+  EXPECT_EQ(tables.at("customer")->row_count(), 1'500u);
+  EXPECT_EQ(tables.at("part")->row_count(), 2'000u);
+  EXPECT_EQ(tables.at("partsupp")->row_count(), 8'000u);
+  EXPECT_EQ(tables.at("orders")->row_count(), 15'000u);
+  EXPECT_GE(tables.at("lineitem")->row_count(), 15'000u);
+  EXPECT_LE(tables.at("lineitem")->row_count(), 7 * 15'000u);
+
+  const auto& line_item = *tables.at("lineitem");
+  EXPECT_EQ(line_item.column_count(), 16u);
+  EXPECT_EQ(line_item.column_type(ColumnID{0}), "int");
+  EXPECT_EQ(line_item.column_type(ColumnID{5}), "float");
+  EXPECT_EQ(line_item.column_type(ColumnID{10}), "string");
+
+  // All chunks but the last one are full
+  EXPECT_EQ(line_item.chunk_count(), (line_item.row_count() + 999) / 1'000);
+  EXPECT_EQ(line_item.get_chunk(ChunkID{0}).size(), 1'000u);
+}
+
+TEST_F(TpchTableGeneratorTest, IsDeterministic) {
+  // Neither the chunk size nor the number of threads has an effect on the data
+  const auto table = TpchTableGenerator{0.005f, 1'000, 7, 1}.generate_table(TpchTable::LineItem);
+  EXPECT_TABLE_EQ(*table, *TpchTableGenerator{0.005f, 333, 7, 4}.generate_table(TpchTable::LineItem), true);
+  EXPECT_TABLE_EQ(*TpchTableGenerator{0.005f, 1'000, 7, 1}.generate_table(TpchTable::Customer),
+                  *TpchTableGenerator{0.005f, 100, 7, 3}.generate_table(TpchTable::Customer), true);
+
+  const auto other_seed = TpchTableGenerator{0.005f, 1'000, 8, 1}.generate_table(TpchTable::LineItem);
+  EXPECT_NE(_column_values<int32_t>(*table, ColumnID{1}), _column_values<int32_t>(*other_seed, ColumnID{1}));
+}
+
+TEST_F(TpchTableGeneratorTest, KeysAreConsistent) {
+  const auto generator = TpchTableGenerator{0.01f, 4'096};
+  const auto orders = generator.generate_table(TpchTable::Orders);
+  const auto line_item = generator.generate_table(TpchTable::LineItem);
+  const auto part_supp = generator.generate_table(TpchTable::PartSupp);
+
+  const auto order_keys = _column_values<int32_t>(*orders, ColumnID{0});
+  const auto order_key_set = std::unordered_set<int32_t>(order_keys.begin(), order_keys.end());
+  EXPECT_EQ(order_key_set.size(), order_keys.size());
+  for (const auto order_key : _column_values<int32_t>(*line_item, ColumnID{0})) {
+    EXPECT_TRUE(order_key_set.count(order_key));
+  }
+
+  // Every (part, supplier) pair of a line item is listed in partsupp
+  const auto part_supp_part_keys = _column_values<int32_t>(*part_supp, ColumnID{0});
+  const auto part_supp_supplier_keys = _column_values<int32_t>(*part_supp, ColumnID{1});
+  auto part_supp_keys = std::unordered_set<int64_t>{};
+  for (auto row = size_t{0}; row < part_supp_part_keys.size(); ++row) {
+    part_supp_keys.insert(int64_t{part_supp_part_keys[row]} << 32 | part_supp_supplier_keys[row]);
+  }
+  EXPECT_EQ(part_supp_keys.size(), part_supp_part_keys.size());
+
+  const auto part_keys = _column_values<int32_t>(*line_item, ColumnID{1});
+  const auto supplier_keys = _column_values<int32_t>(*line_item, ColumnID{2});
+  for (auto row = size_t{0}; row < part_keys.size(); ++row) {
+    EXPECT_TRUE(part_supp_keys.count(int64_t{part_keys[row]} << 32 | supplier_keys[row]));
+  }
+
+  // Ship dates follow the order dates
+  const auto ship_dates = _column_values<std::string>(*line_item, ColumnID{10});
+  EXPECT_EQ(ship_dates.front().size(), 10u);
+  EXPECT_GE(*std::min_element(ship_dates.begin(), ship_dates.end()), "1992-01-02");
+  EXPECT_LE(*std::max_element(ship_dates.begin(), ship_dates.end()), "1998-12-01");
+}
+
+TEST_F(TpchTableGeneratorTest, GenerateAndStore) {
+  TpchTableGenerator{0.001f}.generate_and_store();
+
+  auto& storage_manager = StorageManager::get();
+  EXPECT_EQ(storage_manager.table_names().size(), 8u);
+  const auto& nation = storage_manager.get_table("nation")->get_chunk(ChunkID{0});
+  EXPECT_EQ(type_cast<std::string>((*nation.get_segment(ColumnID{1}))[6]), "FRANCE");
+  EXPECT_EQ(storage_manager.get_table("region")->row_count(), 5u);
+}
+
+}  // namespace opossum